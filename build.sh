@@ -157,7 +157,7 @@ print_usage() {
     -d, --directory
         Set the build directory.
     -g, --type
-        Set the build type (Default/Debug).
+        Set the build type (Default/Debug/Release).
     -n, --ncore
         Set the number of cores used by make (default: Output of nproc).
     -c, --clean
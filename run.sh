@@ -159,6 +159,13 @@ parse_debug() {
   QEMU_GDB_PORT="${port}"
 }
 
+parse_profile() {
+  local file=$1
+
+  # COM1 shows the log, COM2 receives the profiling data written by the instrumented system
+  QEMU_ARGS="${QEMU_ARGS} -display none -serial stdio -serial file:${file}"
+}
+
 start_gdb() {
   gdb -x "/tmp/gdbcommands.$(id -u)" "loader/boot/hhuOS.bin"
   exit $?
@@ -179,6 +186,8 @@ print_usage() {
         Set the CPU model, which qemu should emulate (e.g. 486, pentium, pentium2, ...) (Default: base)
     -d, --debug
         Set the port, on which qemu should listen for GDB clients (default: disabled)
+    -p, --profile
+        Run headless and write the profiling data of a PGO build (COM2) to the given file (default: disabled)
     -h, --help
         Show this help message\\n"
 }
@@ -346,6 +355,9 @@ parse_args() {
     -d | --debug)
       parse_debug "$val"
       ;;
+    -p | --profile)
+      parse_profile "$val"
+      ;;
     -g | --gdb)
       start_gdb
       ;;
@@ -18,6 +18,7 @@
 #include "kernel/memory/GlobalDescriptorTable.h"
 #include "device/cpu/Cpu.h"
 #include "kernel/log/Log.h"
+#include "kernel/log/LogFlusher.h"
 #include "GatesOfHell.h"
 #include "kernel/memory/MemoryLayout.h"
 #include "kernel/memory/Paging.h"
@@ -55,6 +56,13 @@
 #include "filesystem/memory/RandomNode.h"
 #include "filesystem/memory/MountsNode.h"
 #include "kernel/memory/MemoryStatusNode.h"
+#include "kernel/process/IdleStatusNode.h"
+#include "kernel/process/LockStatisticsNode.h"
+#include "kernel/process/ProfileNode.h"
+#include "kernel/process/Profiler.h"
+#include "kernel/log/TraceNode.h"
+#include "kernel/log/Trace.h"
+#include "lib/util/async/LockStatistics.h"
 #include "device/system/FirmwareConfiguration.h"
 #include "filesystem/qemu/FirmwareConfigurationDriver.h"
 #include "filesystem/acpi/AcpiDriver.h"
@@ -126,6 +134,7 @@
 #include "device/time/rtc/Cmos.h"
 #include "device/graphic/VesaBiosExtensions.h"
 #include "device/time/acpi/AcpiTimer.h"
+#include "device/time/tsc/Tsc.h"
 
 namespace Util {
 class HeapMemoryManager;
@@ -358,6 +367,21 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
         Kernel::Log::setLevel(level);
     }
 
+    // Set log levels for individual subsystems (e.g. 'log_subsystem_levels=device/usb:wrn,kernel/network:dbg')
+    if (multiboot->hasKernelOption("log_subsystem_levels")) {
+        Kernel::Log::setSubsystemLevels(multiboot->getKernelOption("log_subsystem_levels"));
+    }
+
+    // Enable contention statistics for named locks (readable via /system/locks/statistics)
+    if (multiboot->getKernelOption("lock_statistics", "false") == "true") {
+        Util::Async::LockStatistics::enable();
+    }
+
+    // Start the sampling profiler at boot (controlled and readable via /system/profile)
+    if (multiboot->getKernelOption("profiler", "false") == "true") {
+        Kernel::Profiler::start();
+    }
+
     // Memory management has been set up now, and we continue with the remaining boot process
     LOG_INFO("Welcome to hhuOS!");
     LOG_INFO("Used kernel heap memory during early boot process: [%u KiB]", (kernelHeapManager.getTotalMemory() - kernelHeapManager.getFreeMemory()) / 1024);
@@ -517,15 +541,29 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     }
 
     Device::WaitTimer *waitTimer = acpiTimer == nullptr ? static_cast<Device::WaitTimer*>(pit) : static_cast<Device::WaitTimer*>(acpiTimer);
-    auto *timeService = new Kernel::TimeService(waitTimer, pit, rtc);
+
+    // Use the TSC as high resolution clocksource, if available (calibrated against the ACPI timer or PIT)
+    Device::Tsc *tsc = nullptr;
+    if (multiboot->getKernelOption("tsc", "true") == "true" && Device::Tsc::isAvailable()) {
+        LOG_INFO("Calibrating TSC");
+        tsc = new Device::Tsc(*waitTimer);
+    }
+
+    Device::TimeProvider *timeProvider = tsc == nullptr ? static_cast<Device::TimeProvider*>(pit) : static_cast<Device::TimeProvider*>(tsc);
+    auto *timeService = new Kernel::TimeService(waitTimer, timeProvider, rtc);
     Kernel::Service::registerService(Kernel::TimeService::SERVICE_ID, timeService);
 
+    if (tsc != nullptr) {
+        tsc->publish(timeService->getTimePage());
+    }
+
     // Initialize classic PIC
     LOG_INFO("Initializing PIC");
     auto *pic = new Device::Pic();
     interruptService->usePic(pic);
 
     // Check if APIC exists and initialize it
+    bool tickless = false;
     if (multiboot->getKernelOption("apic", "true") == "true" && Device::Apic::isAvailable()) {
         LOG_INFO("APIC detected");
         auto *apic = Device::Apic::initialize();
@@ -533,7 +571,13 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
             LOG_WARN("Failed to initialize APIC -> Falling back to PIC");
         } else {
             interruptService->useApic(apic);
-            apic->startCurrentTimer();
+
+            // Tickless operation needs the TSC as clocksource, since the PIT interrupt is not used for timekeeping anymore
+            tickless = tsc != nullptr && multiboot->getKernelOption("tickless", "true") == "true";
+            apic->startCurrentTimer(tickless);
+            if (tickless) {
+                scheduler.setOneShotTimer(&apic->getCurrentTimer());
+            }
 
             if (apic->isSymmetricMultiprocessingSupported()) {
                 apic->startupApplicationProcessors();
@@ -547,6 +591,10 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     auto &refillThread = Kernel::Thread::createKernelThread("Paging-Area-Pool-Refiller", processService->getKernelProcess(), new Kernel::PagingAreaManagerRefillRunnable(*pagingAreaManager));
     scheduler.ready(refillThread);
 
+    // Create thread to write buffered log messages to the registered output streams
+    auto &logFlusherThread = Kernel::Thread::createKernelThread("Log-Flusher", processService->getKernelProcess(), new Kernel::LogFlusher());
+    scheduler.ready(logFlusherThread);
+
     // Register memory manager
     Util::Reflection::InstanceFactory::registerPrototype(new Util::FreeListMemoryManager());
 
@@ -567,7 +615,11 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     Device::Cpu::enableInterrupts();
     Device::Cmos::enableNmi();
 
-    pit->plugin();
+    // The PIT interrupt is only needed for timekeeping and preemption, which are handled by the TSC and APIC timer in tickless mode
+    if (!tickless) {
+        pit->plugin();
+    }
+
     if (rtc != nullptr) {
         rtc->plugin();
     }
@@ -639,12 +691,32 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
     filesystemService->createDirectory("/process");
     filesystemService->getFilesystem().mountVirtualDriver("/process", processDriver);
 
+    auto *lockDriver = new Filesystem::Memory::MemoryDriver();
+    filesystemService->createDirectory("/system/locks");
+    filesystemService->getFilesystem().mountVirtualDriver("/system/locks", lockDriver);
+    lockDriver->addNode("/", new Kernel::LockStatisticsNode("statistics"));
+
+    auto *profileDriver = new Filesystem::Memory::MemoryDriver();
+    filesystemService->createDirectory("/system/profile");
+    filesystemService->getFilesystem().mountVirtualDriver("/system/profile", profileDriver);
+    profileDriver->addNode("/", new Kernel::ProfileNode("control", Kernel::ProfileNode::CONTROL));
+    profileDriver->addNode("/", new Kernel::ProfileNode("flat", Kernel::ProfileNode::FLAT));
+    profileDriver->addNode("/", new Kernel::ProfileNode("callgraph", Kernel::ProfileNode::CALL_GRAPH));
+
+    auto *traceDriver = new Filesystem::Memory::MemoryDriver();
+    filesystemService->createDirectory("/system/trace");
+    filesystemService->getFilesystem().mountVirtualDriver("/system/trace", traceDriver);
+    traceDriver->addNode("/", new Kernel::TraceNode("control", Kernel::TraceNode::CONTROL));
+    traceDriver->addNode("/", new Kernel::TraceNode("events", Kernel::TraceNode::TEXT));
+    traceDriver->addNode("/", new Kernel::TraceNode("chrome.json", Kernel::TraceNode::CHROME_JSON));
+
     filesystemService->createFile("/device/log");
     deviceDriver->addNode("/", new Filesystem::Memory::NullNode());
     deviceDriver->addNode("/", new Filesystem::Memory::ZeroNode());
     deviceDriver->addNode("/", new Filesystem::Memory::RandomNode());
     deviceDriver->addNode("/", new Filesystem::Memory::MountsNode());
     deviceDriver->addNode("/", new Kernel::MemoryStatusNode("memory"));
+    deviceDriver->addNode("/", new Kernel::IdleStatusNode("idle"));
 
     if (Device::FirmwareConfiguration::isAvailable()) {
         auto *fwCfg = new Device::FirmwareConfiguration();
@@ -811,8 +883,10 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
         }
     }
 
-    // Ready 'shell' process
-    Util::Async::Process::execute(Util::Io::File("/bin/shell"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), "uptime", Util::Array<Util::String>(0));
+    // Ready 'shell' process (optionally running a script non-interactively, e.g. to collect profiles)
+    const auto shellScript = multiboot->getKernelOption("shell_script", "");
+    const auto shellArguments = shellScript.isEmpty() ? Util::Array<Util::String>(0) : Util::Array<Util::String>({"--script", shellScript});
+    Util::Async::Process::execute(Util::Io::File("/bin/shell"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), "uptime", shellArguments);
 
     // Clear screen and print banner
     Kernel::Log::removeOutputStream(*terminal);
@@ -836,6 +910,11 @@ void GatesOfHell::enter(uint32_t multibootMagic, const Kernel::Multiboot *multib
                           << "Build date: " << BuildConfig::getBuildDate() << Util::Io::PrintStream::endl << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
     }
 
+    // Enable kernel tracepoints from the start (controlled and readable via /system/trace)
+    if (multiboot->getKernelOption("trace", "false") == "true") {
+        Kernel::Trace::enable();
+    }
+
     LOG_INFO("Starting scheduler");
     processService->startScheduler();
 
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+#include <cstdarg>
+#include <utility>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/base/StringBuilder.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/time/Timestamp.h"
+
+struct Result {
+    uint32_t allocations;
+    uint32_t time;
+};
+
+static uint32_t getAllocationCount() {
+    return Util::System::getAddressSpaceHeader().memoryManager.getAllocationCount();
+}
+
+template<typename Function>
+Result benchmark(uint32_t iterations, Function function) {
+    auto allocations = getAllocationCount();
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        function(i);
+    }
+
+    return { getAllocationCount() - allocations, static_cast<uint32_t>(Util::Time::getSystemTime().toMilliseconds() - start) };
+}
+
+/**
+ * Copy a value, even if it is a temporary that could be moved (like it was done before move semantics were supported).
+ */
+template<typename T>
+T copy(const T &value) {
+    return value;
+}
+
+/**
+ * Hide that a string is a temporary, so that operator+ copies it instead of appending to it in place.
+ */
+const Util::String& asLvalue(const Util::String &string) {
+    return string;
+}
+
+Util::String formatLogMessage(const char *message...) {
+    va_list args;
+    va_start(args, message);
+
+    // Similar to Kernel::Log::logDefault()
+    auto logMessage = Util::String::format("[%u.%03u][%s][%s:%s] ", 42, 17, "INFO", "allocbench.cpp", "42") + Util::String::vformat(message, args);
+
+    va_end(args);
+    return logMessage;
+}
+
+Util::String formatLogMessageCopying(const char *message...) {
+    va_list args;
+    va_start(args, message);
+
+    const auto prefix = Util::String::format("[%u.%03u][%s][%s:%s] ", 42, 17, "INFO", "allocbench.cpp", "42");
+    const auto text = Util::String::vformat(message, args);
+    const auto logMessage = prefix + text;
+
+    va_end(args);
+    return copy(logMessage);
+}
+
+Util::String formatAllocations(const Result &result, uint32_t iterations) {
+    auto allocationsPerIteration = static_cast<double>(result.allocations) / iterations;
+    return Util::String::format("%u.%02u", static_cast<uint32_t>(allocationsPerIteration), static_cast<uint32_t>((allocationsPerIteration - static_cast<uint32_t>(allocationsPerIteration)) * 100));
+}
+
+void printComparison(Util::Io::PrintStream &stream, const char *name, const Result &before, const Result &after, uint32_t iterations) {
+    stream << name << ": " << formatAllocations(before, iterations) << " -> " << formatAllocations(after, iterations) << " allocations per iteration ("
+           << before.allocations << " -> " << after.allocations << "), " << before.time << "ms -> " << after.time << "ms" << Util::Io::PrintStream::endl;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Heap allocation benchmark for common string and collection operations.\n"
+                               "Counts the allocations performed by the process heap for each test, copying intermediate values and moving them (Default: 1000 iterations).\n"
+                               "Usage: allocbench [ITERATIONS]\n"
+                               "Options:\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto iterations = static_cast<uint32_t>(arguments.length() == 0 ? 1000 : Util::String::parseInt(arguments[0]));
+    auto &out = Util::System::out;
+
+    out << "Running allocation benchmarks with " << iterations << " iterations..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+
+    // Each test runs twice: First copying every intermediate value (the behaviour before move semantics were supported),
+    // then moving temporaries. Small strings never allocate in both runs, since the small-string optimization is always active.
+
+    // Logging: Format a message and store it in a log buffer
+    Util::ArrayList<Util::String> copyingLogBuffer;
+    auto logCopyingResult = benchmark(iterations, [&copyingLogBuffer](uint32_t i) {
+        const auto message = formatLogMessageCopying("Processing request [%u] from device [%s]", i, "ide0");
+        copyingLogBuffer.add(message);
+    });
+
+    Util::ArrayList<Util::String> logBuffer;
+    auto logResult = benchmark(iterations, [&logBuffer](uint32_t i) {
+        auto message = formatLogMessage("Processing request [%u] from device [%s]", i, "ide0");
+        logBuffer.add(std::move(message));
+    });
+
+    // Shell: Split a command line into command and arguments, like the shell does before executing a binary
+    const Util::String commandLine = "cat /user/books/alice.txt > /device/terminal";
+    auto shellCopyingResult = benchmark(iterations, [&commandLine](uint32_t) {
+        auto pipeSplit = copy(commandLine.split(">"));
+        auto command = copy(pipeSplit[0].substring(0, commandLine.indexOf(" ")));
+        auto rest = copy(pipeSplit[0].substring(commandLine.indexOf(" "), commandLine.length()));
+        auto commandArguments = copy(rest.split(" "));
+        auto targetFile = copy(copy(pipeSplit[1].split(" "))[0]);
+    });
+
+    auto shellResult = benchmark(iterations, [&commandLine](uint32_t) {
+        auto pipeSplit = commandLine.split(">");
+        auto command = pipeSplit[0].substring(0, commandLine.indexOf(" "));
+        auto rest = pipeSplit[0].substring(commandLine.indexOf(" "), commandLine.length());
+        auto commandArguments = rest.split(" ");
+        auto targetFile = pipeSplit[1].split(" ")[0];
+    });
+
+    // Filesystem: Canonicalize a path containing relative components (the canonicalization itself always uses move semantics)
+    auto pathCopyingResult = benchmark(iterations, [](uint32_t) {
+        auto path = copy(Util::Io::File::getCanonicalPath("/user/books/../wav/./../books/alice.txt"));
+    });
+
+    auto pathResult = benchmark(iterations, [](uint32_t) {
+        auto path = Util::Io::File::getCanonicalPath("/user/books/../wav/./../books/alice.txt");
+    });
+
+    // Concatenation: Chained operator+ on copied and on moved temporaries, versus a preallocated StringBuilder
+    auto concatCopyingResult = benchmark(iterations, [](uint32_t) {
+        auto string = copy(asLvalue(asLvalue(asLvalue(asLvalue(asLvalue(asLvalue(Util::String("/system")) + "/") + "network") + "/") + "interfaces") + "/") + "eth0");
+    });
+
+    auto concatResult = benchmark(iterations, [](uint32_t) {
+        auto string = Util::String("/system") + "/" + "network" + "/" + "interfaces" + "/" + "eth0";
+    });
+
+    auto builderResult = benchmark(iterations, [](uint32_t) {
+        Util::StringBuilder builder(32);
+        builder.append("/system").append('/').append("network").append('/').append("interfaces").append('/').append("eth0");
+        auto string = builder.build();
+    });
+
+    // Collections: Get all keys of a map
+    Util::HashMap<Util::String, uint32_t> map;
+    for (uint32_t i = 0; i < 32; i++) {
+        map.put(Util::String::format("key%u", i), i);
+    }
+
+    auto mapCopyingResult = benchmark(iterations, [&map](uint32_t) {
+        auto keys = copy(map.keys());
+    });
+
+    auto mapResult = benchmark(iterations, [&map](uint32_t) {
+        auto keys = map.keys();
+    });
+
+    out << Util::Io::PrintStream::endl << "Copying -> Moving:" << Util::Io::PrintStream::endl;
+    printComparison(out, "Log message", logCopyingResult, logResult, iterations);
+    printComparison(out, "Shell command", shellCopyingResult, shellResult, iterations);
+    printComparison(out, "Canonical path", pathCopyingResult, pathResult, iterations);
+    printComparison(out, "Concatenation", concatCopyingResult, concatResult, iterations);
+    printComparison(out, "HashMap keys", mapCopyingResult, mapResult, iterations);
+
+    out << Util::Io::PrintStream::endl << "Concatenation -> StringBuilder:" << Util::Io::PrintStream::endl;
+    printComparison(out, "Path", concatResult, builderResult, iterations);
+    out << Util::Io::PrintStream::flush;
+
+    return 0;
+}
@@ -25,6 +25,8 @@
 #include "lib/util/game/GameManager.h"
 #include "lib/util/game/Game.h"
 #include "RainEmitter.h"
+#include "lib/util/game/2d/particle/ParticleSystem.h"
+#include "lib/util/math/Math.h"
 #include "Ground.h"
 #include "lib/util/game/Graphics.h"
 #include "lib/util/graphic/Color.h"
@@ -32,7 +34,18 @@
 #include "lib/util/math/Vector2D.h"
 
 ParticleDemo::ParticleDemo() {
-    cloud = new RainEmitter(Util::Math::Vector2D(0, 0.8));
+    // Splashes of all raindrops share a single particle system, which is drawn on top of the ground
+    splashes = new Util::Game::D2::ParticleSystem(SPLASH_TAG, Util::Math::Vector2D(0, 0), MAX_SPLASH_PARTICLES);
+    splashes->setAngleRange(0, Util::Math::PI);
+    splashes->setSpeedRange(1, 1);
+    splashes->setTimeToLiveRange(1, 1);
+    splashes->setAcceleration(Util::Math::Vector2D(0, -2.5));
+    splashes->setFloor(-0.8);
+    splashes->setParticleSize(0.005);
+    splashes->setParticleColor(Util::Graphic::Color(0, 96, 192));
+    splashes->setFadeOut(true);
+
+    cloud = new RainEmitter(Util::Math::Vector2D(0, 0.8), *splashes);
     addObject(cloud);
 
     for (uint32_t i = 0; i < 3; i++) {
@@ -40,6 +53,8 @@ ParticleDemo::ParticleDemo() {
         addObject(newGround);
     }
 
+    addObject(splashes);
+
     setKeyListener(*this);
 }
 
@@ -21,6 +21,8 @@
 #ifndef HHUOS_PARTICLEDEMO_H
 #define HHUOS_PARTICLEDEMO_H
 
+#include <cstdint>
+
 #include "lib/util/game/2d/Scene.h"
 #include "lib/util/game/KeyListener.h"
 
@@ -28,6 +30,9 @@ class RainEmitter;
 namespace Util {
 namespace Game {
 class Graphics;
+namespace D2 {
+class ParticleSystem;
+}  // namespace D2
 }  // namespace Game
 namespace Io {
 class Key;
@@ -68,6 +73,10 @@ public:
 private:
 
     RainEmitter *cloud = nullptr;
+    Util::Game::D2::ParticleSystem *splashes = nullptr;
+
+    static const constexpr uint32_t SPLASH_TAG = 2;
+    static const constexpr uint32_t MAX_SPLASH_PARTICLES = 4096;
 };
 
 #endif
@@ -22,12 +22,10 @@
 
 #include "lib/util/game/2d/event/TranslationEvent.h"
 #include "lib/util/game/2d/component/LinearMovementComponent.h"
-#include "DropletEmitter.h"
-#include "lib/util/game/GameManager.h"
-#include "lib/util/game/Scene.h"
 #include "lib/util/base/String.h"
 #include "lib/util/game/2d/collider/RectangleCollider.h"
 #include "lib/util/game/2d/particle/Particle.h"
+#include "lib/util/game/2d/particle/ParticleSystem.h"
 #include "lib/util/game/Collider.h"
 #include "lib/util/math/Vector2D.h"
 
@@ -40,7 +38,7 @@ class CollisionEvent;
 }  // namespace Game
 }  // namespace Util
 
-RainEmitter::RainEmitter(const Util::Math::Vector2D &position) : Util::Game::D2::Emitter(TAG, PARTICLE_TAG, position, -1) {}
+RainEmitter::RainEmitter(const Util::Math::Vector2D &position, Util::Game::D2::ParticleSystem &splashes) : Util::Game::D2::Emitter(TAG, PARTICLE_TAG, position, -1), splashes(splashes) {}
 
 void RainEmitter::initialize() {
     Emitter::initialize();
@@ -87,6 +85,5 @@ void RainEmitter::onParticleInitialization(Util::Game::D2::Particle &particle) {
 void RainEmitter::onParticleUpdate(Util::Game::D2::Particle &particle, double delta) {}
 
 void RainEmitter::onParticleDestruction(Util::Game::D2::Particle &particle) {
-    auto *dropletEmitter = new DropletEmitter(particle.getPosition());
-    Util::Game::GameManager::getCurrentScene().addObject(dropletEmitter);
+    splashes.emit(particle.getPosition(), SPLASH_PARTICLES);
 }
@@ -33,6 +33,7 @@ class Graphics;
 namespace D2 {
 class CollisionEvent;
 class Particle;
+class ParticleSystem;
 class TranslationEvent;
 }  // namespace D2
 }  // namespace Game
@@ -47,7 +48,7 @@ public:
     /**
      * Default.
      */
-    explicit RainEmitter(const Util::Math::Vector2D &position);
+    RainEmitter(const Util::Math::Vector2D &position, Util::Game::D2::ParticleSystem &splashes);
 
     /**
      * Copy Constructor.
@@ -87,8 +88,10 @@ private:
 
     Util::Math::Random random;
     Util::Game::D2::Sprite cloudSprite;
+    Util::Game::D2::ParticleSystem &splashes;
 
     static const constexpr double SPEED = 0.25;
+    static const constexpr uint32_t SPLASH_PARTICLES = 5;
 };
 
 #endif
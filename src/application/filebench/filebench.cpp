@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr uint32_t DEFAULT_FILE_SIZE = 4096;
+static const constexpr uint32_t DEFAULT_CHUNK_SIZE = 64;
+
+static uint32_t toKibPerSecond(uint32_t kib, uint32_t milliseconds) {
+    return milliseconds == 0 ? kib * 1000 : static_cast<uint32_t>(static_cast<uint64_t>(kib) * 1000 / milliseconds);
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.addArgument("chunk", false, "c");
+    argumentParser.setHelpText("File write/read benchmark, building a large file out of small chunks.\n"
+                               "The file is written sequentially, read back, truncated and removed afterwards.\n"
+                               "Usage: filebench [OPTION]... [FILE] [SIZE]\n"
+                               "Options:\n"
+                               "  -c, --chunk: Size of each write/read operation in bytes (Default: 64)\n"
+                               "  -h, --help: Show this help message\n"
+                               "FILE defaults to '/device/filebench' (memory filesystem), SIZE is given in KiB (Default: 4096)");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto path = arguments.length() > 0 ? arguments[0] : Util::String("/device/filebench");
+    auto fileSize = static_cast<uint32_t>(arguments.length() > 1 ? Util::String::parseInt(arguments[1]) : DEFAULT_FILE_SIZE);
+    auto chunkSize = static_cast<uint32_t>(argumentParser.hasArgument("chunk") ? Util::String::parseInt(argumentParser.getArgument("chunk")) : DEFAULT_CHUNK_SIZE);
+    if (chunkSize == 0 || fileSize == 0) {
+        Util::System::error << "filebench: Invalid size!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto file = Util::Io::File(path);
+    if (file.exists()) {
+        Util::System::error << "filebench: '" << path << "' already exists!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (!file.create(Util::Io::File::REGULAR)) {
+        Util::System::error << "filebench: Failed to create '" << path << "'!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto totalBytes = static_cast<uint64_t>(fileSize) * 1024;
+    auto *buffer = new uint8_t[chunkSize];
+    for (uint32_t i = 0; i < chunkSize; i++) {
+        buffer[i] = static_cast<uint8_t>(i);
+    }
+
+    Util::System::out << "Writing " << fileSize << " KiB in chunks of " << chunkSize << " bytes to '" << path << "'..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    {
+        auto outputStream = Util::Io::FileOutputStream(file);
+        for (uint64_t written = 0; written < totalBytes; written += chunkSize) {
+            auto length = totalBytes - written < chunkSize ? static_cast<uint32_t>(totalBytes - written) : chunkSize;
+            outputStream.write(buffer, 0, length);
+        }
+    }
+    uint32_t writeResult = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    Util::System::out << "Reading file back..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    uint64_t readBytes = 0;
+    start = Util::Time::getSystemTime().toMilliseconds();
+    {
+        auto inputStream = Util::Io::FileInputStream(file);
+        int32_t count;
+        while ((count = inputStream.read(buffer, 0, chunkSize)) > 0) {
+            readBytes += count;
+        }
+    }
+    uint32_t readResult = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    start = Util::Time::getSystemTime().toMilliseconds();
+    auto truncated = file.controlFile(Util::Io::File::TRUNCATE, Util::Array<uint32_t>({0}));
+    uint32_t truncateResult = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    if (!file.remove()) {
+        Util::System::error << "filebench: Failed to remove '" << path << "'!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    }
+
+    delete[] buffer;
+
+    Util::System::out << Util::Io::PrintStream::endl
+                      << "write: " << writeResult << "ms (" << toKibPerSecond(fileSize, writeResult) << " KiB/s)" << Util::Io::PrintStream::endl
+                      << "read: " << readResult << "ms (" << toKibPerSecond(fileSize, readResult) << " KiB/s)" << Util::Io::PrintStream::endl;
+    if (truncated) {
+        Util::System::out << "truncate: " << truncateResult << "ms" << Util::Io::PrintStream::endl;
+    } else {
+        Util::System::out << "truncate: Not supported by filesystem" << Util::Io::PrintStream::endl;
+    }
+
+    if (readBytes != totalBytes) {
+        Util::System::error << "filebench: Read " << static_cast<uint32_t>(readBytes) << " bytes, but expected " << static_cast<uint32_t>(totalBytes) << "!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/async/Executor.h"
+#include "lib/util/async/Parallel.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/base/System.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/graphic/Ansi.h"
+#include "lib/util/graphic/Color.h"
+#include "lib/util/graphic/LinearFrameBuffer.h"
+#include "lib/util/graphic/PixelDrawer.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/InputStream.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/time/Timestamp.h"
+
+static const constexpr double MIN_REAL = -2.5;
+static const constexpr double MAX_REAL = 1.0;
+static const constexpr double CENTER_IMAGINARY = 0.0;
+
+uint32_t iterate(double real, double imaginary, uint32_t maxIterations) {
+    double zReal = 0, zImaginary = 0;
+    uint32_t i = 0;
+
+    while (i < maxIterations && zReal * zReal + zImaginary * zImaginary <= 4) {
+        auto newReal = zReal * zReal - zImaginary * zImaginary + real;
+        zImaginary = 2 * zReal * zImaginary + imaginary;
+        zReal = newReal;
+        i++;
+    }
+
+    return i;
+}
+
+Util::Graphic::Color getColor(uint32_t iterations, uint32_t maxIterations) {
+    if (iterations == maxIterations) {
+        return Util::Graphic::Color(0, 0, 0);
+    }
+
+    return Util::Graphic::Color(static_cast<uint8_t>(iterations * 9), static_cast<uint8_t>(iterations * 5), static_cast<uint8_t>(iterations * 3 + 64));
+}
+
+/**
+ * Render a single row of the Mandelbrot set. Rows are independent of each other, so they can be rendered in parallel.
+ * Returns the amount of iterations computed for this row.
+ */
+uint32_t renderRow(const Util::Graphic::PixelDrawer &pixelDrawer, uint16_t resolutionX, uint16_t resolutionY, uint16_t y, uint32_t maxIterations) {
+    const auto scale = (MAX_REAL - MIN_REAL) / resolutionX;
+    const auto imaginary = CENTER_IMAGINARY + (y - resolutionY / 2.0) * scale;
+    uint32_t totalIterations = 0;
+
+    for (uint16_t x = 0; x < resolutionX; x++) {
+        auto iterations = iterate(MIN_REAL + x * scale, imaginary, maxIterations);
+        pixelDrawer.drawPixel(x, y, getColor(iterations, maxIterations));
+        totalIterations += iterations;
+    }
+
+    return totalIterations;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Render the Mandelbrot set, first on a single thread and then in parallel using a thread pool.\n"
+                               "Both render times and the resulting speedup are printed after a key has been pressed.\n"
+                               "Usage: mandelbrot [OPTIONS]...\n"
+                               "Options:\n"
+                               "  -t, --threads: Amount of worker threads (Default: 4)\n"
+                               "  -i, --iterations: Maximum iterations per pixel (Default: 256)\n"
+                               "  -r, --resolution: Set display resolution\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addArgument("threads", false, "t");
+    argumentParser.addArgument("iterations", false, "i");
+    argumentParser.addArgument("resolution", false, "r");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto threads = static_cast<uint32_t>(argumentParser.hasArgument("threads") ? Util::String::parseInt(argumentParser.getArgument("threads")) : 4);
+    auto maxIterations = static_cast<uint32_t>(argumentParser.hasArgument("iterations") ? Util::String::parseInt(argumentParser.getArgument("iterations")) : 256);
+    if (threads == 0 || maxIterations == 0) {
+        Util::System::error << "mandelbrot: Thread and iteration count must be greater than 0!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto lfbFile = Util::Io::File("/device/lfb");
+
+    if (argumentParser.hasArgument("resolution")) {
+        auto split1 = argumentParser.getArgument("resolution").split("x");
+        auto split2 = split1[1].split("@");
+
+        uint32_t resolutionX = Util::String::parseInt(split1[0]);
+        uint32_t resolutionY = Util::String::parseInt(split2[0]);
+        uint32_t colorDepth = split2.length() > 1 ? Util::String::parseInt(split2[1]) : 32;
+
+        lfbFile.controlFile(Util::Graphic::LinearFrameBuffer::SET_RESOLUTION, Util::Array<uint32_t>({resolutionX, resolutionY, colorDepth}));
+    }
+
+    auto lfb = Util::Graphic::LinearFrameBuffer(lfbFile);
+    auto pixelDrawer = Util::Graphic::PixelDrawer(lfb);
+    const auto resolutionX = lfb.getResolutionX();
+    const auto resolutionY = lfb.getResolutionY();
+
+    Util::Graphic::Ansi::prepareGraphicalApplication(false);
+
+    // Single threaded reference
+    lfb.clear();
+    uint32_t sequentialIterations = 0;
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint16_t y = 0; y < resolutionY; y++) {
+        sequentialIterations += renderRow(pixelDrawer, resolutionX, resolutionY, y, maxIterations);
+    }
+    auto sequentialTime = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    // Parallel rendering (one task per row, since the cost per row varies strongly)
+    lfb.clear();
+    uint64_t parallelTime;
+    uint32_t parallelIterations;
+    {
+        auto executor = Util::Async::Executor(threads);
+        start = Util::Time::getSystemTime().toMilliseconds();
+        parallelIterations = Util::Async::parallelReduce(executor, 0, resolutionY, 1, static_cast<uint32_t>(0),
+                [&](uint32_t y) { return renderRow(pixelDrawer, resolutionX, resolutionY, y, maxIterations); },
+                [](uint32_t first, uint32_t second) { return first + second; });
+        parallelTime = Util::Time::getSystemTime().toMilliseconds() - start;
+    }
+
+    Util::System::in.read();
+    Util::Graphic::Ansi::cleanupGraphicalApplication();
+
+    auto speedup = parallelTime == 0 ? 0 : static_cast<double>(sequentialTime) / parallelTime;
+    Util::System::out << "Resolution: " << resolutionX << "x" << resolutionY << ", " << maxIterations << " iterations" << Util::Io::PrintStream::endl
+                      << "1 thread: " << static_cast<uint32_t>(sequentialTime) << "ms (" << sequentialIterations << " iterations)" << Util::Io::PrintStream::endl
+                      << threads << " threads: " << static_cast<uint32_t>(parallelTime) << "ms (" << parallelIterations << " iterations)" << Util::Io::PrintStream::endl
+                      << "Speedup: " << Util::String::format("%u.%02ux", static_cast<uint32_t>(speedup), static_cast<uint32_t>((speedup - static_cast<uint32_t>(speedup)) * 100))
+                      << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+
+    return 0;
+}
@@ -19,6 +19,7 @@
 
 #include "lib/util/base/System.h"
 #include "lib/util/base/Address.h"
+#include "lib/util/base/CpuDispatch.h"
 #include "lib/util/time/Timestamp.h"
 #include "lib/util/base/MmxAddress.h"
 #include "lib/util/hardware/CpuId.h"
@@ -31,6 +32,13 @@
 #include "lib/util/io/stream/PrintStream.h"
 
 static const constexpr uint32_t BUFFER_SIZE = 1024 * 1024;
+static const constexpr uint32_t ROUTINE_COUNT = 2;
+static const char *ROUTINE_NAMES[ROUTINE_COUNT] = { "memcpy", "blend" };
+
+Util::String formatSpeedup(uint32_t reference, uint32_t result) {
+    double speedup = static_cast<double>(reference) / (result == 0 ? 1 : result);
+    return Util::String::format("%u.%02ux", static_cast<uint32_t>(speedup), static_cast<uint32_t>((speedup - static_cast<uint32_t>(speedup)) * 100));
+}
 
 void benchmark(uint32_t iterations, const Util::Address<uint32_t> &source, const Util::Address<uint32_t> &target, uint32_t &memsetResult, uint32_t &memcpyResult) {
     auto start = Util::Time::getSystemTime().toMilliseconds();
@@ -46,9 +54,25 @@ void benchmark(uint32_t iterations, const Util::Address<uint32_t> &source, const
     memcpyResult = Util::Time::getSystemTime().toMilliseconds() - start;
 }
 
+void benchmarkRoutines(uint32_t iterations, const Util::CpuDispatch::Routines &routines, uint8_t *source, uint8_t *target, uint32_t *results) {
+    for (uint32_t routine = 0; routine < ROUTINE_COUNT; routine++) {
+        auto start = Util::Time::getSystemTime().toMilliseconds();
+        for (uint32_t i = 0; i < iterations; i++) {
+            switch (routine) {
+                case 0:
+                    routines.copyRange(target, source, BUFFER_SIZE);
+                    break;
+                default:
+                    routines.blendPixels(reinterpret_cast<uint32_t*>(target), reinterpret_cast<const uint32_t*>(source), source, BUFFER_SIZE / sizeof(uint32_t), 192);
+            }
+        }
+        results[routine] = Util::Time::getSystemTime().toMilliseconds() - start;
+    }
+}
+
 int32_t main(int32_t argc, char *argv[]) {
     auto argumentParser = Util::ArgumentParser();
-    argumentParser.setHelpText("Memory bandwidth benchmark comparing different acceleration techniques.\n"
+    argumentParser.setHelpText("Memory bandwidth benchmark comparing different acceleration techniques and all variants of the dispatched routines.\n"
                                "Each iteration operates on 1 MiB of memory (Default: 100 iterations).\n"
                                "Usage: membench [ITERATIONS]\n"
                                "Options:\n"
@@ -84,11 +108,9 @@ int32_t main(int32_t argc, char *argv[]) {
 
         Util::Math::endMmx();
 
-        double memsetSpeedup = (double) memsetResult / memsetMmxResult;
-        double memcpySpeedup = (double) memcpyResult / memcpyMmxResult;
-        auto memsetString = Util::String::format("%u.%02ux", static_cast<uint32_t>(memsetSpeedup), static_cast<uint32_t>((memsetSpeedup - static_cast<uint32_t>(memsetSpeedup)) * 100));
-        auto memcpyString = Util::String::format("%u.%02ux", static_cast<uint32_t>(memcpySpeedup), static_cast<uint32_t>((memcpySpeedup - static_cast<uint32_t>(memcpySpeedup)) * 100));
-        
+        auto memsetString = formatSpeedup(memsetResult, memsetMmxResult);
+        auto memcpyString = formatSpeedup(memcpyResult, memcpyMmxResult);
+
         resultWriter << Util::Io::PrintStream::endl << "MMX enabled:" << Util::Io::PrintStream::endl
                      << "memset: " << memsetMmxResult << "ms (" << memsetString << ")" << Util::Io::PrintStream::endl
                      << "memcpy: " << memcpyMmxResult << "ms (" << memcpyString << ")" << Util::Io::PrintStream::endl;
@@ -99,16 +121,38 @@ int32_t main(int32_t argc, char *argv[]) {
         Util::System::out << "Running memory benchmarks with SSE..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
         benchmark(iterations, Util::SseAddress<uint32_t>(buffer1), Util::SseAddress<uint32_t>(buffer2), memsetSseResult, memcpySseResult);
 
-        double memsetSpeedup = (double) memsetResult / memsetSseResult;
-        double memcpySpeedup = (double) memcpyResult / memcpySseResult;
-        auto memsetString = Util::String::format("%u.%02ux", static_cast<uint32_t>(memsetSpeedup), static_cast<uint32_t>((memsetSpeedup - static_cast<uint32_t>(memsetSpeedup)) * 100));
-        auto memcpyString = Util::String::format("%u.%02ux", static_cast<uint32_t>(memcpySpeedup), static_cast<uint32_t>((memcpySpeedup - static_cast<uint32_t>(memcpySpeedup)) * 100));
+        auto memsetString = formatSpeedup(memsetResult, memsetSseResult);
+        auto memcpyString = formatSpeedup(memcpyResult, memcpySseResult);
 
         resultWriter << Util::Io::PrintStream::endl << "SSE enabled:" << Util::Io::PrintStream::endl
                      << "memset: " << memsetSseResult << "ms (" << memsetString << ")" << Util::Io::PrintStream::endl
                      << "memcpy: " << memcpySseResult << "ms (" << memcpyString << ")" << Util::Io::PrintStream::endl;
     }
-    
+
+    // Compare all variants of the dispatched routines, which are supported by this CPU
+    uint32_t genericResults[ROUTINE_COUNT];
+    for (uint32_t i = Util::CpuDispatch::GENERIC; i < Util::CpuDispatch::VARIANT_COUNT; i++) {
+        const auto variant = static_cast<Util::CpuDispatch::Variant>(i);
+        if (!Util::CpuDispatch::isSupported(variant)) {
+            continue;
+        }
+
+        uint32_t variantResults[ROUTINE_COUNT];
+        auto *results = variant == Util::CpuDispatch::GENERIC ? genericResults : variantResults;
+        Util::System::out << "Running dispatched routines (" << Util::CpuDispatch::getVariantName(variant) << ")..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        benchmarkRoutines(iterations, Util::CpuDispatch::getRoutines(variant), buffer1, buffer2, results);
+
+        resultWriter << Util::Io::PrintStream::endl << "Dispatched routines (" << Util::CpuDispatch::getVariantName(variant)
+                     << (variant == Util::CpuDispatch::getVariant() ? ", active" : "") << "):" << Util::Io::PrintStream::endl;
+        for (uint32_t routine = 0; routine < ROUTINE_COUNT; routine++) {
+            resultWriter << ROUTINE_NAMES[routine] << ": " << results[routine] << "ms";
+            if (variant != Util::CpuDispatch::GENERIC) {
+                resultWriter << " (" << formatSpeedup(genericResults[routine], results[routine]) << ")";
+            }
+            resultWriter << Util::Io::PrintStream::endl;
+        }
+    }
+
     delete[] buffer1;
     delete[] buffer2;
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/async/Process.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/BufferedInputStream.h"
+#include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr char *CONTROL_PATH = "/system/profile/control";
+
+bool writeCommand(const Util::String &command) {
+    auto controlFile = Util::Io::File(CONTROL_PATH);
+    if (!controlFile.exists()) {
+        Util::System::error << "perf: Profiler not available!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return false;
+    }
+
+    auto outputStream = Util::Io::FileOutputStream(controlFile);
+    outputStream.write(static_cast<const uint8_t*>(command), 0, command.length());
+    return true;
+}
+
+void printReport(const Util::String &path, uint32_t maxLines) {
+    auto reportFile = Util::Io::File(path);
+    auto fileStream = Util::Io::FileInputStream(reportFile);
+    auto inputStream = Util::Io::BufferedInputStream(fileStream);
+
+    bool endOfFile = false;
+    auto line = inputStream.readLine(endOfFile);
+    for (uint32_t i = 0; !endOfFile && (maxLines == 0 || i < maxLines); i++) {
+        Util::System::out << line << Util::Io::PrintStream::endl;
+        line = inputStream.readLine(endOfFile);
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Profile the system with the timer driven sampling profiler.\n"
+                               "Runs the given command while sampling and prints a report afterwards.\n"
+                               "Without a command, the report of the last profiling session is printed.\n"
+                               "Usage: perf [OPTION]... [COMMAND] [ARGUMENT]...\n"
+                               "Options:\n"
+                               "  -g, --callgraph: Print the call graph instead of the flat profile\n"
+                               "  -n, --lines: Print at most the given amount of report lines\n"
+                               "  -s, --start: Start sampling in the background (stop with '--stop')\n"
+                               "  -t, --stop: Stop sampling\n"
+                               "  -h, --help: Show this help message");
+
+    argumentParser.addSwitch("callgraph", "g");
+    argumentParser.addArgument("lines", false, "n");
+    argumentParser.addSwitch("start", "s");
+    argumentParser.addSwitch("stop", "t");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (argumentParser.checkSwitch("start")) {
+        return writeCommand("start") ? 0 : -1;
+    }
+
+    if (argumentParser.checkSwitch("stop")) {
+        return writeCommand("stop") ? 0 : -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    if (arguments.length() > 0) {
+        auto command = arguments[0];
+        auto binaryFile = Util::Io::File(command.contains('/') ? command : "/bin/" + command);
+        if (!binaryFile.exists() || binaryFile.isDirectory()) {
+            Util::System::error << "perf: '" << command << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+            return -1;
+        }
+
+        auto commandArguments = Util::Array<Util::String>(arguments.length() - 1);
+        for (uint32_t i = 1; i < arguments.length(); i++) {
+            commandArguments[i - 1] = arguments[i];
+        }
+
+        if (!writeCommand("start")) {
+            return -1;
+        }
+
+        auto terminalFile = Util::Io::File("/device/terminal");
+        auto process = Util::Async::Process::execute(binaryFile, terminalFile, terminalFile, terminalFile, command, commandArguments);
+        process.join();
+
+        writeCommand("stop");
+    }
+
+    auto maxLines = argumentParser.hasArgument("lines") ? static_cast<uint32_t>(Util::String::parseInt(argumentParser.getArgument("lines"))) : 0;
+    printReport(argumentParser.checkSwitch("callgraph") ? "/system/profile/callgraph" : "/system/profile/flat", maxLines);
+
+    return 0;
+}
@@ -22,6 +22,7 @@
 #include "lib/util/io/file/File.h"
 #include "lib/util/io/stream/PrintStream.h"
 #include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/BufferedInputStream.h"
 #include "lib/util/graphic/LinearFrameBuffer.h"
 #include "lib/util/collection/ArrayList.h"
 #include "Shell.h"
@@ -45,6 +46,33 @@ void Shell::run() {
     }
 }
 
+void Shell::runScript(const Util::String &path) {
+    auto script = Util::Io::File(path);
+    if (!script.exists() || !script.isFile()) {
+        Util::System::error << "Script '" << path << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return;
+    }
+
+    if (!Util::Io::File::changeDirectory(startDirectory)) {
+        Util::System::error << "Unable to start shell in '" << startDirectory << "'!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return;
+    }
+
+    auto scriptStream = Util::Io::FileInputStream(script);
+    auto bufferedStream = Util::Io::BufferedInputStream(scriptStream);
+    bool endOfFile = false;
+
+    auto line = bufferedStream.readLine(endOfFile);
+    while (isRunning && !endOfFile) {
+        currentLine = line.strip();
+        if (!currentLine.isEmpty() && !currentLine.beginsWith("#")) {
+            parseInput();
+        }
+
+        line = bufferedStream.readLine(endOfFile);
+    }
+}
+
 void Shell::beginCommandLine() {
     currentLine = "";
     sub_index = 0;
@@ -58,6 +58,14 @@ public:
 
     void run() override;
 
+    /**
+     * Execute the commands of a script file line by line, instead of reading them interactively.
+     * Empty lines and lines beginning with '#' are ignored.
+     *
+     * @param path The path to the script file
+     */
+    void runScript(const Util::String &path);
+
 private:
 
     void beginCommandLine();
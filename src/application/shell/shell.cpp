@@ -25,17 +25,26 @@
 int32_t main(int32_t argc, char *argv[]) {
     auto argumentParser = Util::ArgumentParser();
     argumentParser.setHelpText("A simple UNIX-like shell.\n"
-                               "Usage: shell\n"
+                               "Usage: shell [OPTION]... [DIRECTORY]\n"
                                "Options:\n"
+                               "  -s, --script: Execute the commands of the given file and exit\n"
                                "  -h, --help: Show this help message");
 
+    argumentParser.addArgument("script", false, "s");
+
     if (!argumentParser.parse(argc, argv)) {
         Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
         return -1;
     }
 
-    Shell shell(argc > 1 ? argv[1] : "/");
-    shell.run();
+    auto arguments = argumentParser.getUnnamedArguments();
+    Shell shell(arguments.length() > 0 ? arguments[0] : "/");
+
+    if (argumentParser.hasArgument("script")) {
+        shell.runScript(argumentParser.getArgument("script"));
+    } else {
+        shell.run();
+    }
 
     return 0;
 }
\ No newline at end of file
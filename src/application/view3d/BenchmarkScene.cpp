@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BenchmarkScene.h"
+
+#include "application/view3d/ModelEntity.h"
+#include "lib/util/game/Game.h"
+#include "lib/util/game/GameManager.h"
+#include "lib/util/game/Graphics.h"
+#include "lib/util/math/Math.h"
+#include "lib/util/math/Vector3D.h"
+
+BenchmarkScene::BenchmarkScene(const Util::String &path, uint32_t modelCount, bool filled, Result &result) : result(result) {
+    // Arrange models in a square grid, far enough away from the camera to fit into the view frustum
+    auto gridSize = static_cast<uint32_t>(Util::Math::sqrt(static_cast<double>(modelCount)));
+    if (gridSize * gridSize < modelCount) {
+        gridSize++;
+    }
+
+    const auto offset = (gridSize - 1) * MODEL_SPACING / 2;
+    const auto distance = gridSize * MODEL_SPACING * 1.5 + 2;
+
+    for (uint32_t i = 0; i < modelCount; i++) {
+        auto position = Util::Math::Vector3D((i % gridSize) * MODEL_SPACING - offset, (i / gridSize) * MODEL_SPACING - offset, distance);
+        auto *model = new ModelEntity(path, position);
+        model->setFilled(filled);
+        model->setRotation(Util::Math::Vector3D(i * 15, i * 30, 0));
+        addObject(model);
+    }
+
+    result = {0, 0, 0};
+}
+
+void BenchmarkScene::initialize(Util::Game::Graphics &graphics) {
+    Util::Game::D3::Scene::initialize(graphics);
+    BenchmarkScene::graphics = &graphics;
+}
+
+void BenchmarkScene::update(double delta) {
+    // Counters have been set while drawing the previous frame
+    if (elapsedTime > 0) {
+        result.frames++;
+        result.triangles += graphics->getDrawnTriangleCounter();
+    }
+
+    elapsedTime += delta;
+    if (elapsedTime >= DURATION) {
+        result.milliseconds = static_cast<uint32_t>(elapsedTime * 1000);
+        Util::Game::GameManager::getGame().stop();
+        return;
+    }
+
+    for (auto *entity : entities) {
+        reinterpret_cast<ModelEntity*>(entity)->rotate(Util::Math::Vector3D(20, 40, 0) * delta);
+    }
+}
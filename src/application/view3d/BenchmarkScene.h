@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_VIEW3D_BENCHMARKSCENE_H
+#define HHUOS_VIEW3D_BENCHMARKSCENE_H
+
+#include <cstdint>
+
+#include "lib/util/game/3d/Scene.h"
+#include "lib/util/base/String.h"
+
+namespace Util {
+namespace Game {
+class Graphics;
+}  // namespace Game
+}  // namespace Util
+
+/**
+ * Renders a grid of rotating models for a fixed amount of time and measures the rasterizer's throughput.
+ */
+class BenchmarkScene : public Util::Game::D3::Scene {
+
+public:
+
+    struct Result {
+        uint32_t frames;
+        uint32_t triangles;
+        uint32_t milliseconds;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param path The model to render
+     * @param modelCount The amount of models in the scene
+     * @param filled Draw filled triangles instead of wireframes
+     * @param result Receives the measured values, once the benchmark has finished
+     */
+    BenchmarkScene(const Util::String &path, uint32_t modelCount, bool filled, Result &result);
+
+    /**
+     * Copy Constructor.
+     */
+    BenchmarkScene(const BenchmarkScene &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BenchmarkScene &operator=(const BenchmarkScene &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BenchmarkScene() override = default;
+
+    void initialize(Util::Game::Graphics &graphics) override;
+
+    void update(double delta) override;
+
+private:
+
+    Result &result;
+    Util::Game::Graphics *graphics = nullptr;
+    double elapsedTime = 0;
+
+    static const constexpr double DURATION = 10;
+    static const constexpr double MODEL_SPACING = 2.5;
+};
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "lib/util/game/3d/Model.h"
 #include "lib/util/base/String.h"
+#include "lib/util/math/Vector3D.h"
 
 namespace Util {
 namespace Game {
@@ -37,6 +38,11 @@ public:
      */
     explicit ModelEntity(const Util::String &modelPath);
 
+    /**
+     * Constructor.
+     */
+    ModelEntity(const Util::String &modelPath, const Util::Math::Vector3D &position);
+
     /**
      * Copy Constructor.
      */
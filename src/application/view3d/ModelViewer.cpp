@@ -25,8 +25,9 @@
 #include "lib/util/io/key/MouseDecoder.h"
 #include "lib/util/math/Vector2D.h"
 
-ModelViewer::ModelViewer(const Util::String &path) {
+ModelViewer::ModelViewer(const Util::String &path, bool filled) {
     model = new ModelEntity(path);
+    model->setFilled(filled);
     addObject(model);
 
     setKeyListener(*this);
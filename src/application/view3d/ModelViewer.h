@@ -48,7 +48,7 @@ public:
     /**
      * Constructor.
      */
-    explicit ModelViewer(const Util::String &path);
+    ModelViewer(const Util::String &path, bool filled);
 
     /**
      * Copy Constructor.
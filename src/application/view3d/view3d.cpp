@@ -28,9 +28,11 @@
 #include "lib/util/game/Engine.h"
 #include "lib/util/game/GameManager.h"
 #include "ModelViewer.h"
+#include "BenchmarkScene.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/game/Game.h"
+#include "lib/util/game/3d/ObjectFile.h"
 
 int32_t main(int32_t argc, char *argv[]) {
     auto argumentParser = Util::ArgumentParser();
@@ -40,10 +42,16 @@ int32_t main(int32_t argc, char *argv[]) {
                                "ESC to exit.\n\n"
                                "Usage: view3do [FILE]\n"
                                "Options:\n"
-                               "  -r, --resolution: Set display resolution"
+                               "  -r, --resolution: Set display resolution\n"
+                               "  -f, --filled: Draw filled, flat shaded triangles instead of wireframes\n"
+                               "  -b, --benchmark: Render the given amount of models for 10 seconds and report triangles per second\n"
+                               "  -c, --convert: Convert the model into a binary mesh file, which is loaded instead of 'name.obj', if saved as 'name.mesh'\n"
                                "  -h, --help: Show this help message");
 
     argumentParser.addArgument("resolution", false, "r");
+    argumentParser.addArgument("benchmark", false, "b");
+    argumentParser.addArgument("convert", false, "c");
+    argumentParser.addSwitch("filled", "f");
 
     if (!argumentParser.parse(argc, argv)) {
         Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
@@ -63,6 +71,17 @@ int32_t main(int32_t argc, char *argv[]) {
         return -1;
     }
 
+    if (argumentParser.hasArgument("convert")) {
+        auto *objectFile = Util::Game::D3::ObjectFile::open(file.getCanonicalPath());
+        objectFile->save(argumentParser.getArgument("convert"));
+
+        Util::System::out << "Converted '" << args[0] << "' (" << objectFile->getVertices().length() << " vertices, "
+                          << objectFile->getEdges().length() << " edges, " << objectFile->getTriangles().length() / 3 << " triangles)"
+                          << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        delete objectFile;
+        return 0;
+    }
+
     auto lfbFile = Util::Io::File("/device/lfb");
 
     if (argumentParser.hasArgument("resolution")) {
@@ -76,9 +95,27 @@ int32_t main(int32_t argc, char *argv[]) {
         lfbFile.controlFile(Util::Graphic::LinearFrameBuffer::SET_RESOLUTION, Util::Array<uint32_t>({resolutionX, resolutionY, colorDepth}));
     }
 
+    auto filled = argumentParser.checkSwitch("filled");
     auto lfb = Util::Graphic::LinearFrameBuffer(lfbFile);
+
+    if (argumentParser.hasArgument("benchmark")) {
+        auto modelCount = static_cast<uint32_t>(Util::String::parseInt(argumentParser.getArgument("benchmark")));
+        auto result = BenchmarkScene::Result{};
+
+        // Run without frame rate limit, so that the measured throughput is not capped
+        auto engine = Util::Game::Engine(lfb, UINT8_MAX);
+        Util::Game::GameManager::getGame().pushScene(new BenchmarkScene(file.getCanonicalPath(), modelCount, filled, result));
+        engine.run();
+
+        auto seconds = result.milliseconds == 0 ? 1.0 : result.milliseconds / 1000.0;
+        Util::System::out << "Models: " << modelCount << " (" << (filled ? "filled" : "wireframe") << ")" << Util::Io::PrintStream::endl
+                          << "Frames: " << result.frames << " (" << static_cast<uint32_t>(result.frames / seconds) << " FPS)" << Util::Io::PrintStream::endl
+                          << "Triangles: " << result.triangles << " (" << static_cast<uint32_t>(result.triangles / seconds) << " triangles/s)" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return 0;
+    }
+
     auto engine = Util::Game::Engine(lfb, 60);
-    Util::Game::GameManager::getGame().pushScene(new ModelViewer(file.getCanonicalPath()));
+    Util::Game::GameManager::getGame().pushScene(new ModelViewer(file.getCanonicalPath(), filled));
     engine.run();
 
     return 0;
@@ -49,6 +49,17 @@ void Cpu::disableInterrupts() {
     asm volatile ( "cli" );
 }
 
+bool Cpu::areInterruptsEnabled() {
+    uint32_t flags;
+    asm volatile (
+            "pushf;"
+            "pop %0"
+            : "=r"(flags)
+    );
+
+    return (flags & INTERRUPT_FLAG) != 0;
+}
+
 void Cpu::halt() {
     asm volatile (
             "cli;"
@@ -112,6 +112,11 @@ public:
      */
     static void disableInterrupts();
 
+    /**
+     * Check the interrupt flag of the current CPU.
+     */
+    [[nodiscard]] static bool areInterruptsEnabled();
+
     static uint32_t readCr0();
 
     static void writeCr0(uint32_t value);
@@ -177,6 +182,8 @@ private:
      * Interrupts stay disabled, as long as this number is greater than zero.
      */
     static int32_t cliCount;
+
+    static const constexpr uint32_t INTERRUPT_FLAG = 0x200;
 };
 
 }
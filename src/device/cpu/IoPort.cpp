@@ -112,4 +112,18 @@ uint32_t IoPort::readDoubleWord(uint16_t offset) const {
     return ret;
 }
 
+void IoPort::readWords(uint16_t *buffer, uint32_t count) const {
+    asm volatile ("rep insw"
+    : "+D"(buffer), "+c"(count)
+    : "d"(address.get())
+    : "memory");
+}
+
+void IoPort::writeWords(const uint16_t *buffer, uint32_t count) const {
+    asm volatile ("rep outsw"
+    : "+S"(buffer), "+c"(count)
+    : "d"(address.get())
+    : "memory");
+}
+
 }
\ No newline at end of file
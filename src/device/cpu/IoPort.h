@@ -148,6 +148,22 @@ public:
      */
     uint32_t readDoubleWord(uint16_t offset) const;
 
+    /**
+     * Read multiple words from this TransferMode-port (using 'rep insw').
+     *
+     * @param buffer The buffer to read into
+     * @param count Amount of words to read
+     */
+    void readWords(uint16_t *buffer, uint32_t count) const;
+
+    /**
+     * Write multiple words to this TransferMode-port (using 'rep outsw').
+     *
+     * @param buffer The buffer to write from
+     * @param count Amount of words to write
+     */
+    void writeWords(const uint16_t *buffer, uint32_t count) const;
+
 private:
 
     Util::Address<uint16_t> address;
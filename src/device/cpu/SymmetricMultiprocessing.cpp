@@ -30,7 +30,11 @@ volatile bool runningApplicationProcessors[256]{}; // Once an AP is running it s
 
 [[noreturn]] void applicationProcessorEntry(uint8_t initializedApplicationProcessorsCounter) {
     runningApplicationProcessors[initializedApplicationProcessorsCounter] = true; // Mark this AP as running
-    while (true) {}
+
+    // APs are not used by the scheduler yet -> Halt instead of spinning (interrupts are still disabled on this core)
+    while (true) {
+        asm volatile ("hlt");
+    }
 
     // Initialize this AP's APIC
     auto &interruptService = Kernel::Service::getService<Kernel::InterruptService>();
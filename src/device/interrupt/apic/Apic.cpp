@@ -293,14 +293,14 @@ bool Apic::isCurrentTimerRunning() {
     return localTimers.get(LocalApic::getId()) != nullptr;
 }
 
-void Apic::startCurrentTimer() {
+void Apic::startCurrentTimer(bool oneShot) {
     if (isCurrentTimerRunning()) {
         LOG_WARN("Trying to start an already running APIC timer");
         return;
     }
 
     ApicTimer::calibrate();
-    auto *apicTimer = new Device::ApicTimer(Util::Time::Timestamp::ofMilliseconds(10), Util::Time::Timestamp::ofMilliseconds(10));
+    auto *apicTimer = new Device::ApicTimer(Util::Time::Timestamp::ofMilliseconds(10), Util::Time::Timestamp::ofMilliseconds(10), oneShot);
     apicTimer->plugin();
     localTimers.put(LocalApic::getId(), apicTimer);
 }
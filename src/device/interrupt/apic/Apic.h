@@ -125,8 +125,10 @@ public:
 
     /**
      * Initialize the current processor's local APIC timer.
+     *
+     * @param oneShot Run the timer in one-shot mode, letting the scheduler program each expiry (tickless operation)
      */
-    void startCurrentTimer();
+    void startCurrentTimer(bool oneShot = false);
 
     /**
      * Get the ApicTimer instance that belongs to the current CPU.
@@ -30,6 +30,7 @@
 #include "kernel/service/MemoryService.h"
 #include "lib/util/base/Constants.h"
 #include "kernel/memory/BitmapMemoryManager.h"
+#include "kernel/log/Trace.h"
 
 namespace Device::Network {
 
@@ -91,6 +92,8 @@ void NetworkDevice::sendPacket(const uint8_t *packet, uint32_t length) {
 }
 
 void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length) {
+    TRACEPOINT(PACKET_RECEIVED, length);
+
     if (!Kernel::Network::Ethernet::EthernetModule::checkPacket(packet, length)) {
         return; // Discard packets failing the checksum test
     }
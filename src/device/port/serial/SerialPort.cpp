@@ -29,6 +29,9 @@
 #include "device/port/serial/SimpleSerialPort.h"
 #include "kernel/service/Service.h"
 #include "lib/util/base/String.h"
+#include "lib/util/async/Atomic.h"
+#include "device/cpu/Cpu.h"
+#include "SerialStatisticsNode.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -36,7 +39,12 @@ struct InterruptFrame;
 
 namespace Device {
 
-SerialPort::SerialPort(Serial::ComPort port, Serial::BaudRate dataRate) : Util::Io::FilterInputStream(inputStream), inputBuffer(BUFFER_SIZE), inputStream(inputBuffer), port(port, dataRate) {}
+SerialPort::SerialPort(Serial::ComPort port, Serial::BaudRate dataRate) : Util::Io::FilterInputStream(inputStream), inputBuffer(BUFFER_SIZE), inputStream(inputBuffer), port(port, dataRate) {
+    // The FIFO buffers have been enabled by SimpleSerialPort -> Bits 6 and 7 of the interrupt identification register
+    // are only set, if the FIFOs are actually working (16550A and newer). Older UARTs can only hold a single byte.
+    fifoSize = (this->port.fifoControlRegister.readByte() & 0xc0) == 0xc0 ? FIFO_SIZE : 1;
+    statistics.fifoSize = fifoSize;
+}
 
 bool SerialPort::checkPort(Serial::ComPort port) {
     IoPort scratchRegister(port + 7);
@@ -67,6 +75,7 @@ void SerialPort::initializePort(Serial::ComPort port) {
 
     if (success) {
         serialPort->plugin();
+        driver.addNode("/", new SerialStatisticsNode(Util::String(portToString(port)).toLowerCase() + "_statistics", *serialPort));
     } else {
         LOG_ERROR("%s: Failed to add node", portToString(port));
         delete streamNode;
@@ -90,11 +99,13 @@ void SerialPort::plugin() {
         interruptService.allowHardwareInterrupt(Device::InterruptRequest::COM2);
     }
 
-    port.interruptRegister.writeByte(0x01);
+    port.interruptRegister.writeByte(RECEIVED_DATA_AVAILABLE_INTERRUPT);
+    transmitInterruptEnabled = true;
 }
 
 void SerialPort::trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptVector slot) {
-    if (port.fifoControlRegister.readByte() & 0x01) {
+    const auto interruptIdentification = port.fifoControlRegister.readByte();
+    if (interruptIdentification & 0x01) {
         return;
     }
 
@@ -102,6 +113,18 @@ void SerialPort::trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptV
         uint8_t byte = port.dataRegister.readByte();
         inputBuffer.offer(byte == 13 ? '\n' : byte);
     }
+
+    if ((interruptIdentification & 0x0e) == 0x02) {
+        Util::Async::Atomic<uint32_t>(statistics.transmitInterrupts).inc();
+    }
+
+    // A transmitter interrupt may be hidden behind a receive interrupt with higher priority,
+    // so the line status is checked every time instead of relying on the interrupt identification
+    if (port.lineStatusRegister.readByte() & 0x20) {
+        // Transmitter holding register is empty -> Refill the FIFO with the next batch from the transmit buffer
+        Util::Async::Atomic<uint32_t>(transmitPending).set(1);
+        handlePendingTransmission();
+    }
 }
 
 void SerialPort::setDataRate(Serial::BaudRate rate) {
@@ -113,11 +136,91 @@ Serial::BaudRate SerialPort::getDataRate() const {
 }
 
 void SerialPort::write(uint8_t c) {
-    port.write(c);
+    write(&c, 0, 1);
 }
 
 void SerialPort::write(const uint8_t *sourceBuffer, uint32_t offset, uint32_t length) {
-    port.write(sourceBuffer, offset, length);
+    if (!transmitInterruptEnabled) {
+        port.write(sourceBuffer, offset, length);
+        return;
+    }
+
+    transmitLock.acquire();
+
+    for (uint32_t i = 0; i < length; i++) {
+        const auto c = sourceBuffer[offset + i];
+        if (c == '\n') {
+            enqueue(13);
+        }
+
+        enqueue(c);
+    }
+
+    statistics.bytesWritten += length;
+
+    if (!Cpu::areInterruptsEnabled()) {
+        // No interrupts will arrive to send the data (e.g. during a kernel panic) -> Transmit synchronously
+        while (transmitTail != transmitHead) {
+            while (!(port.lineStatusRegister.readByte() & 0x20)) {}
+            fillTransmitFifo();
+        }
+    } else if (port.lineStatusRegister.readByte() & 0x20) {
+        // Transmitter is idle -> Send the first batch directly, the remaining data is sent by the interrupt handler
+        fillTransmitFifo();
+    } else {
+        // Transmitter is busy -> Make sure that we get notified, when it runs empty
+        port.interruptRegister.writeByte(RECEIVED_DATA_AVAILABLE_INTERRUPT | TRANSMITTER_EMPTY_INTERRUPT);
+    }
+
+    transmitLock.release();
+    handlePendingTransmission();
+}
+
+void SerialPort::enqueue(uint8_t c) {
+    if (transmitHead - transmitTail >= TRANSMIT_BUFFER_SIZE) {
+        // Transmit buffer is full -> Wait for the transmitter, instead of losing data
+        statistics.stalledWrites++;
+        while (transmitHead - transmitTail >= TRANSMIT_BUFFER_SIZE) {
+            while (!(port.lineStatusRegister.readByte() & 0x20)) {}
+            fillTransmitFifo();
+        }
+    }
+
+    transmitBuffer[transmitHead++ % TRANSMIT_BUFFER_SIZE] = c;
+}
+
+void SerialPort::fillTransmitFifo() {
+    uint32_t count = 0;
+    while (count < fifoSize && transmitTail != transmitHead) {
+        port.dataRegister.writeByte(transmitBuffer[transmitTail++ % TRANSMIT_BUFFER_SIZE]);
+        count++;
+    }
+
+    statistics.bytesTransmitted += count;
+
+    // Only request transmitter interrupts, as long as there is data left to send
+    port.interruptRegister.writeByte(transmitTail == transmitHead ? RECEIVED_DATA_AVAILABLE_INTERRUPT : RECEIVED_DATA_AVAILABLE_INTERRUPT | TRANSMITTER_EMPTY_INTERRUPT);
+}
+
+void SerialPort::handlePendingTransmission() {
+    // The interrupt handler must never spin on the transmit lock, since it may have interrupted the lock holder.
+    // Instead, it marks the transmission as pending and the lock holder picks it up after releasing the lock.
+    auto pending = Util::Async::Atomic<uint32_t>(transmitPending);
+    while (pending.get() != 0 && transmitLock.tryAcquire()) {
+        pending.set(0);
+        if (port.lineStatusRegister.readByte() & 0x20) {
+            fillTransmitFifo();
+        }
+
+        transmitLock.release();
+    }
+}
+
+SerialPort::Statistics SerialPort::getStatistics() const {
+    auto result = statistics;
+    result.bytesQueued = transmitHead - transmitTail;
+
+    return result;
 }
 
 uint8_t SerialPort::readDirect() {
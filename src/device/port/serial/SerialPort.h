@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "kernel/interrupt/InterruptHandler.h"
+#include "lib/util/async/Spinlock.h"
 #include "lib/util/io/stream/FilterInputStream.h"
 #include "lib/util/io/stream/OutputStream.h"
 #include "lib/util/collection/ArrayBlockingQueue.h"
@@ -37,11 +38,22 @@ namespace Device {
 
 /**
  * Driver for the serial COM-ports.
+ * Outgoing data is queued in a transmit ring buffer and sent by the interrupt handler,
+ * which refills the transmitter FIFO (16 bytes on a 16550) each time the transmitter holding register runs empty.
  */
 class SerialPort : public Util::Io::FilterInputStream, public Util::Io::OutputStream, public Kernel::InterruptHandler {
 
 public:
 
+    struct Statistics {
+        uint32_t bytesWritten;
+        uint32_t bytesTransmitted;
+        uint32_t bytesQueued;
+        uint32_t transmitInterrupts;
+        uint32_t stalledWrites;
+        uint8_t fifoSize;
+    };
+
     explicit SerialPort(Serial::ComPort port, Serial::BaudRate dataRate = Serial::BaudRate::BAUD_115200);
 
     /**
@@ -96,16 +108,39 @@ public:
 
     uint8_t readDirect();
 
+    [[nodiscard]] Statistics getStatistics() const;
+
 private:
 
     static void initializePort(Serial::ComPort port);
 
+    void enqueue(uint8_t c);
+
+    void fillTransmitFifo();
+
+    void handlePendingTransmission();
+
+    static const constexpr uint32_t BUFFER_SIZE = 1024;
+    static const constexpr uint32_t TRANSMIT_BUFFER_SIZE = 4096;
+    static const constexpr uint8_t FIFO_SIZE = 16;
+
+    static const constexpr uint8_t RECEIVED_DATA_AVAILABLE_INTERRUPT = 0x01;
+    static const constexpr uint8_t TRANSMITTER_EMPTY_INTERRUPT = 0x02;
+
     Util::ArrayBlockingQueue<uint8_t> inputBuffer;
     Util::Io::QueueInputStream inputStream;
 
     SimpleSerialPort port;
 
-    static const constexpr uint32_t BUFFER_SIZE = 1024;
+    uint8_t transmitBuffer[TRANSMIT_BUFFER_SIZE]{};
+    uint32_t transmitHead = 0;
+    uint32_t transmitTail = 0;
+    uint32_t transmitPending = 0;
+    bool transmitInterruptEnabled = false;
+    Util::Async::Spinlock transmitLock;
+
+    uint8_t fifoSize;
+    Statistics statistics{};
 };
 
 }
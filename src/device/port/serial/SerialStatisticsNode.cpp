@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SerialStatisticsNode.h"
+
+#include "device/port/serial/SerialPort.h"
+
+namespace Device {
+
+SerialStatisticsNode::SerialStatisticsNode(const Util::String &name, const SerialPort &serialPort) : StringNode(name), serialPort(serialPort) {}
+
+Util::String SerialStatisticsNode::getString() {
+    const auto statistics = serialPort.getStatistics();
+    const auto bytesPerInterrupt = statistics.transmitInterrupts == 0 ? 0 : statistics.bytesTransmitted / statistics.transmitInterrupts;
+
+    return Util::String::format("FIFO size: %u\nBytes written: %u\nBytes transmitted: %u\nBytes queued: %u\nTransmit interrupts: %u (%u bytes per interrupt)\nStalled writes: %u\n",
+                                statistics.fifoSize, statistics.bytesWritten, statistics.bytesTransmitted, statistics.bytesQueued,
+                                statistics.transmitInterrupts, bytesPerInterrupt, statistics.stalledWrites);
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SERIALSTATISTICSNODE_H
+#define HHUOS_SERIALSTATISTICSNODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Device {
+class SerialPort;
+
+/**
+ * Shows the transmit throughput counters of a serial port (bytes written, bytes sent, interrupts and stalls).
+ */
+class SerialStatisticsNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    SerialStatisticsNode(const Util::String &name, const SerialPort &serialPort);
+
+    /**
+     * Copy Constructor.
+     */
+    SerialStatisticsNode(const SerialStatisticsNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SerialStatisticsNode& operator=(const SerialStatisticsNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SerialStatisticsNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+
+private:
+
+    const SerialPort &serialPort;
+};
+
+}
+
+#endif
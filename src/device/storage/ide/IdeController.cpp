@@ -44,6 +44,8 @@
 #include "lib/util/collection/Iterator.h"
 #include "kernel/service/Service.h"
 #include "kernel/service/TimeService.h"
+#include "kernel/service/InformationService.h"
+#include "kernel/multiboot/Multiboot.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -67,6 +69,12 @@ IdeController::IdeController(const PciDevice &pciDevice) {
         dmaBaseAddress = pciDevice.readDoubleWord(Pci::Register::BASE_ADDRESS_4) & 0xfffffffc;
 
         command |= Pci::BUS_MASTER;
+
+        const auto &multiboot = Kernel::Service::getService<Kernel::InformationService>().getMultibootInformation();
+        dmaEnabled = multiboot.getKernelOption("ide_dma", "true") == "true";
+        if (!dmaEnabled) {
+            LOG_INFO("DMA has been disabled by kernel option -> Using PIO only");
+        }
     }
 
     pciDevice.writeWord(Pci::COMMAND, command);
@@ -96,6 +104,14 @@ IdeController::IdeController(const PciDevice &pciDevice) {
         }
 
         channels[i] = ChannelRegisters(baseAddress, controlBaseAddress, dmaBaseAddress + (i == 0 ? 0 : BUS_MASTER_CHANNEL_OFFSET));
+
+        if (supportsDma) {
+            // Descriptor table and transfer buffer are allocated once and reused for all DMA transfers on this channel
+            auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
+            channels[i].prdt = static_cast<PhysicalRegionDescriptor*>(memoryService.mapIO(1));
+            channels[i].prdtPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(channels[i].prdt));
+            channels[i].dmaBuffer = static_cast<uint8_t*>(memoryService.mapIO(DMA_BUFFER_PAGES));
+        }
     }
 }
 
@@ -144,9 +160,16 @@ void IdeController::initializeDrives() {
         }
     }
 
+    const auto &multiboot = Kernel::Service::getService<Kernel::InformationService>().getMultibootInformation();
+    const auto benchmark = multiboot.getKernelOption("ide_benchmark", "false") == "true";
+
     auto &storageService = Kernel::Service::getService<Kernel::StorageService>();
     for (auto *device : devices) {
         if (device->getDeviceInfo().type == ATA) {
+            if (benchmark) {
+                measureThroughput(device->getDeviceInfo());
+            }
+
             storageService.registerDevice(device, "ata");
         } else if (device->getDeviceInfo().type == ATAPI) {
             storageService.registerDevice(device, "atapi");
@@ -295,6 +318,13 @@ IdeDevice* IdeController::identifyDrive(uint8_t channel, uint8_t drive) {
 
     info.sectorSize = determineSectorSize(info);
 
+    // Transfer multiple sectors per data request in PIO mode, if supported
+    info.sectorsPerBlock = 1;
+    const auto maxSectorsPerBlock = static_cast<uint8_t>(*(buffer + MULTIPLE_SECTORS) & 0xff);
+    if (info.type == ATA && maxSectorsPerBlock > 1 && setMultipleMode(channel, maxSectorsPerBlock)) {
+        info.sectorsPerBlock = maxSectorsPerBlock;
+    }
+
     copyByteSwappedString(reinterpret_cast<const char*>(buffer + MODEL), info.model, sizeof(info.model));
     copyByteSwappedString(reinterpret_cast<const char*>(buffer + SERIAL), info.serial, sizeof(info.serial));
     copyByteSwappedString(reinterpret_cast<const char*>(buffer + FIRMWARE), info.firmware, sizeof(info.firmware));
@@ -347,6 +377,19 @@ bool IdeController::readAtapiIdentity(uint8_t channel, uint16_t *buffer) {
     return true;
 }
 
+bool IdeController::setMultipleMode(uint8_t channel, uint8_t sectorsPerBlock) {
+    auto &registers = channels[channel];
+    registers.command.sectorCount.writeByte(sectorsPerBlock);
+    registers.command.command.writeByte(SET_MULTIPLE_MODE);
+
+    if (!waitBusy(registers.control.alternateStatus)) {
+        LOG_WARN("Drive on channel [%u] does not accept [%u] sectors per block -> Disabling READ/WRITE MULTIPLE", channel, sectorsPerBlock);
+        return false;
+    }
+
+    return true;
+}
+
 bool IdeController::readAtapiCapacity(uint8_t channel, uint8_t packetLength, uint16_t *buffer) {
     auto &registers = channels[channel];
 
@@ -431,11 +474,25 @@ void IdeController::plugin() {
 }
 
 void IdeController::trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptVector slot) {
+    ChannelRegisters *registers;
     if (slot == Kernel::InterruptVector::PRIMARY_ATA) {
-        channels[0].receivedInterrupt = true;
+        registers = &channels[0];
     } else if (slot == Kernel::InterruptVector::SECONDARY_ATA) {
-        channels[1].receivedInterrupt = true;
+        registers = &channels[1];
+    } else {
+        return;
+    }
+
+    // Reading the status register acknowledges the interrupt on the drive
+    registers->driveStatus = registers->command.status.readByte();
+
+    if (supportsDma) {
+        // Interrupt and error bits are cleared by writing them back
+        registers->dmaStatus = registers->dma.status.readByte();
+        registers->dma.status.writeByte(registers->dmaStatus);
     }
+
+    registers->receivedInterrupt = true;
 }
 
 uint8_t IdeController::getAtapiType(uint16_t signature) {
@@ -511,7 +568,13 @@ uint16_t IdeController::performAtaIO(const DeviceInfo &info, TransferMode mode,
         return 0;
     }
 
-    uint16_t maxSectorCount = info.addressing == LBA48 ? 0xffff : 0xff;
+    // DMA commands only support LBA addressing and transfers are limited by the size of the channel's DMA buffer
+    const bool useDma = dmaEnabled && info.supportsDma() && info.addressing != CHS;
+    uint32_t maxSectorCount = info.addressing == LBA48 ? 0xffff : 0xff;
+    if (useDma && maxSectorCount > DMA_BUFFER_PAGES * Util::PAGESIZE / info.sectorSize) {
+        maxSectorCount = DMA_BUFFER_PAGES * Util::PAGESIZE / info.sectorSize;
+    }
+
     uint32_t processedSectors = 0;
     while (processedSectors < sectorCount) {
         uint32_t sectorsLeft = sectorCount - processedSectors;
@@ -519,10 +582,8 @@ uint16_t IdeController::performAtaIO(const DeviceInfo &info, TransferMode mode,
         uint32_t count = sectorsLeft > maxSectorCount ? maxSectorCount : sectorsLeft;
 
         uint16_t sectors;
-        if (supportsDma && info.supportsDma()) {
-            // TODO: Reactivate DMA once issues on real hardware have been fixed
-            // sectors = performDmaAtaIO(info, mode, reinterpret_cast<uint16_t*>(buffer + (processedSectors * info.sectorSize)), start, count);
-            sectors = performProgrammedAtaIO(info, mode, reinterpret_cast<uint16_t *>(buffer + (processedSectors * info.sectorSize)), start, count);
+        if (useDma) {
+            sectors = performDmaAtaIO(info, mode, reinterpret_cast<uint16_t*>(buffer + (processedSectors * info.sectorSize)), start, count);
         } else {
             sectors = performProgrammedAtaIO(info, mode, reinterpret_cast<uint16_t *>(buffer + (processedSectors * info.sectorSize)), start, count);
         }
@@ -577,11 +638,21 @@ uint16_t IdeController::performProgrammedAtaIO(const DeviceInfo &info, TransferM
     auto &registers = channels[info.channel];
     prepareAtaIO(info, startSector, sectorCount);
 
+    // With READ/WRITE MULTIPLE, the drive transfers a whole block of sectors per data request
+    const bool multiple = info.sectorsPerBlock > 1;
     uint8_t command;
     if (info.addressing == CHS || info.addressing == LBA28) {
-        command = mode == WRITE ? WRITE_PIO_LBA28 : READ_PIO_LBA28;
+        if (multiple) {
+            command = mode == WRITE ? WRITE_MULTIPLE_LBA28 : READ_MULTIPLE_LBA28;
+        } else {
+            command = mode == WRITE ? WRITE_PIO_LBA28 : READ_PIO_LBA28;
+        }
     } else if (info.addressing == LBA48) {
-        command = mode == WRITE ? WRITE_PIO_LBA48 : READ_PIO_LBA48;
+        if (multiple) {
+            command = mode == WRITE ? WRITE_MULTIPLE_LBA48 : READ_MULTIPLE_LBA48;
+        } else {
+            command = mode == WRITE ? WRITE_PIO_LBA48 : READ_PIO_LBA48;
+        }
     } else {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "IDE: Unsupported address type!");
     }
@@ -593,25 +664,31 @@ uint16_t IdeController::performProgrammedAtaIO(const DeviceInfo &info, TransferM
     }
 
     uint32_t i;
-    for (i = 0; i < sectorCount; i++) {
-        if (i > 0 && !waitStatus(registers.control.alternateStatus, DRIVE_READY)) {
+    for (i = 0; i < sectorCount; i += info.sectorsPerBlock) {
+        if (i > 0 && !waitStatus(registers.control.alternateStatus, DATA_REQUEST)) {
             return i;
         }
 
+        const uint32_t blockSectors = sectorCount - i < info.sectorsPerBlock ? sectorCount - i : info.sectorsPerBlock;
+        const uint32_t words = blockSectors * info.sectorSize / 2;
+
         if (mode == READ) {
-            for (uint32_t j = 0; j < info.sectorSize / 2; j++) {
-                *buffer++ = registers.command.data.readWord();
-            }
+            registers.command.data.readWords(buffer, words);
         } else if (mode == WRITE) {
-            for (uint32_t j = 0; j < info.sectorSize / 2; j++) {
-                registers.command.data.writeWord(*buffer++);
-            }
+            registers.command.data.writeWords(buffer, words);
         } else {
             Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "IDE: Unsupported transfer mode!");
         }
+
+        buffer += words;
     }
 
-    return i;
+    // Writes are finished, once the drive has written the last block
+    if (mode == WRITE && !waitBusy(registers.control.alternateStatus)) {
+        return 0;
+    }
+
+    return sectorCount;
 }
 
 uint16_t IdeController::performDmaAtaIO(const DeviceInfo &info, TransferMode mode, uint16_t *buffer, uint64_t startSector, uint16_t sectorCount) {
@@ -627,97 +704,105 @@ uint16_t IdeController::performDmaAtaIO(const DeviceInfo &info, TransferMode mod
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "IDE: Unsupported address type!");
     }
 
-    // Calculate the amount of pages needed for the operation
-    auto size = sectorCount * info.sectorSize;
-    auto pages = size / Util::PAGESIZE + (size % Util::PAGESIZE == 0 ? 0 : 1);
-
-    // Each page corresponds to an 8-byte entry in the PRD
-    auto prdVirtual = reinterpret_cast<uint32_t*>(memoryService.mapIO(pages));
-    auto prdPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(prdVirtual));
-
-    // Allocate memory for the DMA transfer
-    auto dmaMemoryVirtual = reinterpret_cast<uint32_t*>(memoryService.mapIO(pages));
-    auto dmaMemoryPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(dmaMemoryVirtual));
+    const uint32_t size = sectorCount * info.sectorSize;
+    if (size > DMA_BUFFER_PAGES * Util::PAGESIZE) {
+        Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "IDE: DMA transfer exceeds buffer size!");
+    }
 
     if (mode == WRITE) {
         auto source = Util::Address<uint32_t>(buffer);
-        auto target = Util::Address<uint32_t>(dmaMemoryVirtual);
+        auto target = Util::Address<uint32_t>(registers.dmaBuffer);
         target.copyRange(source, size);
     }
 
-    // Fill PRD
-    uint32_t i;
-    for (i = 0; i < (pages - 1); i++) {
-        prdVirtual[2 * i] = dmaMemoryPhysical + (Util::PAGESIZE * i);
-        prdVirtual[(2 * i) + 1] = Util::PAGESIZE;
-    }
+    // Fill PRDT with one entry per physical page, so that no entry crosses a 64 KiB boundary
+    const auto pages = size / Util::PAGESIZE + (size % Util::PAGESIZE == 0 ? 0 : 1);
+    for (uint32_t i = 0; i < pages; i++) {
+        auto *page = registers.dmaBuffer + i * Util::PAGESIZE;
+        auto remaining = size - i * Util::PAGESIZE;
 
-    // Set last PRD entry wit EOT bit
-    prdVirtual[2 * i] = dmaMemoryPhysical + (Util::PAGESIZE * i);
-    prdVirtual[(2 * i) + 1] = (size % Util::PAGESIZE) | PRD_END_OF_TRANSMISSION;
+        registers.prdt[i].address = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(page));
+        registers.prdt[i].byteCount = remaining < Util::PAGESIZE ? remaining : Util::PAGESIZE;
+        registers.prdt[i].flags = i == pages - 1 ? PRD_END_OF_TRANSMISSION : 0;
+    }
 
-    // Prepare DMA transfer to physical address
-    registers.dma.address.writeDoubleWord(prdPhysical);
+    // Stop bus master and prepare DMA transfer to physical address
+    registers.dma.command.writeByte(0x00);
+    registers.dma.address.writeDoubleWord(registers.prdtPhysical);
 
-    // Set DMA direction
-    registers.dma.command.writeByte(mode == READ ? 0x00 : DmaCommand::DIRECTION);
+    // Set DMA direction (the bus master writes to memory, when reading from the drive)
+    const uint8_t direction = mode == READ ? DmaCommand::DIRECTION : 0x00;
+    registers.dma.command.writeByte(direction);
 
     // Clear interrupt and error bits
-    registers.dma.status.writeByte(~(DmaStatus::DMA_ERROR | DmaStatus::INTERRUPT));
+    registers.dma.status.writeByte(registers.dma.status.readByte() | DmaStatus::DMA_ERROR | DmaStatus::INTERRUPT);
+    registers.receivedInterrupt = false;
 
-    // Select drive and sector
+    // Select drive and sector, send command and start DMA transfer
     prepareAtaIO(info, startSector, sectorCount);
-
-    // Send command
     registers.command.command.writeByte(command);
-    if (!waitStatus(registers.control.alternateStatus, DATA_REQUEST)) {
-        delete prdVirtual;
-        delete dmaMemoryVirtual;
-        return 0;
-    }
+    registers.dma.command.writeByte(direction | DmaCommand::ENABLE);
 
-    // Start DMA transfer
-    registers.dma.command.writeByte(DmaCommand::ENABLE);
-
-    registers.receivedInterrupt = false;
-    uint32_t timeout = Util::Time::getSystemTime().toMilliseconds() + DMA_TIMEOUT;
-    do {
-        if (registers.receivedInterrupt) {
-            // Stop DMA and check flags
+    // Completion is signalled by an interrupt -> Give up the CPU instead of polling the drive
+    const auto timeout = Util::Time::getSystemTime().toMilliseconds() + DMA_TIMEOUT;
+    while (!registers.receivedInterrupt) {
+        if (Util::Time::getSystemTime().toMilliseconds() >= timeout) {
             registers.dma.command.writeByte(0x00);
-
-            auto dmaStatus = registers.dma.status.readByte();
-            if ((dmaStatus & DmaStatus::INTERRUPT) == DmaStatus::INTERRUPT) {
-                // An interrupt has been fired -> Check if bus master is still enabled
-                if ((dmaStatus & DmaStatus::BUS_MASTER_ACTIVE) == DmaStatus::BUS_MASTER_ACTIVE) {
-                    // Continue DMA transfer
-                    registers.receivedInterrupt = false;
-                    registers.dma.command.writeByte(DmaCommand::ENABLE);
-                } else {
-                    // DMA transfer is finished
-                    break;
-                }
-            }
+            LOG_ERROR("Timeout during DMA transfer on channel [%u]", info.channel);
+            return 0;
         }
-    } while (Util::Time::getSystemTime().toMilliseconds() < timeout);
 
-    if (Util::Time::getSystemTime().toMilliseconds() >= timeout) {
-        delete prdVirtual;
-        delete dmaMemoryVirtual;
+        Util::Async::Thread::yield();
+    }
+
+    // Stop DMA and check flags
+    registers.dma.command.writeByte(0x00);
+    if ((registers.dmaStatus & DmaStatus::DMA_ERROR) == DmaStatus::DMA_ERROR || (registers.driveStatus & ERROR) == ERROR) {
+        LOG_ERROR("DMA transfer on channel [%u] failed (Bus master status: [0x%02x], Drive status: [0x%02x])", info.channel, registers.dmaStatus, registers.driveStatus);
         return 0;
     }
 
     if (mode == READ) {
-        auto source = Util::Address<uint32_t>(dmaMemoryVirtual);
+        auto source = Util::Address<uint32_t>(registers.dmaBuffer);
         auto target = Util::Address<uint32_t>(buffer);
         target.copyRange(source, size);
     }
 
-    delete prdVirtual;
-    delete dmaMemoryVirtual;
     return sectorCount;
 }
 
+void IdeController::measureThroughput(const DeviceInfo &info) {
+    const auto maxSectors = info.addressing == LBA48 ? info.maxSectorsLba48 : info.maxSectorsLba28;
+    auto sectorCount = BENCHMARK_SIZE / info.sectorSize;
+    if (sectorCount >= maxSectors) {
+        sectorCount = maxSectors - 1;
+    }
+
+    auto *buffer = new uint8_t[sectorCount * info.sectorSize];
+    const auto wasDmaEnabled = dmaEnabled;
+    const auto dmaAvailable = dmaEnabled && info.supportsDma() && info.addressing != CHS;
+
+    // Read the same sequential range once using PIO and once using DMA (if available)
+    for (uint32_t i = 0; i < (dmaAvailable ? 2 : 1); i++) {
+        dmaEnabled = i == 1;
+
+        const auto start = Util::Time::getSystemTime().toMilliseconds();
+        const auto sectors = performAtaIO(info, READ, buffer, 0, sectorCount);
+        auto time = Util::Time::getSystemTime().toMilliseconds() - start;
+        if (time == 0) {
+            time = 1;
+        }
+
+        const auto kib = static_cast<uint32_t>(static_cast<uint64_t>(sectors) * info.sectorSize / 1024);
+        LOG_INFO("Sequential read on drive [%u] on channel [%u] using %s: %u KiB in %u ms (%u KiB/s)", info.drive, info.channel,
+                 dmaEnabled ? "DMA" : (info.sectorsPerBlock > 1 ? "PIO (multiple)" : "PIO"), kib, static_cast<uint32_t>(time),
+                 static_cast<uint32_t>(kib * 1000 / time));
+    }
+
+    dmaEnabled = wasDmaEnabled;
+    delete[] buffer;
+}
+
 void IdeController::prepareAtapiIO(uint8_t channel, uint16_t len) {
     auto &registers = channels[channel];
 
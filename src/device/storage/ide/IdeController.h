@@ -97,7 +97,9 @@ private:
     static const constexpr uint32_t BUS_MASTER_CHANNEL_OFFSET = 0x08;
     static const constexpr uint32_t WAIT_ON_STATUS_TIMEOUT = 4095;
     static const constexpr uint32_t DMA_TIMEOUT = 30000;
-    static const constexpr uint32_t PRD_END_OF_TRANSMISSION = 1 << 31;
+    static const constexpr uint32_t DMA_BUFFER_PAGES = 32;
+    static const constexpr uint16_t PRD_END_OF_TRANSMISSION = 1 << 15;
+    static const constexpr uint32_t BENCHMARK_SIZE = 4 * 1024 * 1024;
 
     enum AddressType : uint8_t {
         CHS = 0x00,
@@ -121,10 +123,15 @@ private:
         READ_PIO_LBA48 = 0x24,
         READ_DMA_LBA28 = 0xC8,
         READ_DMA_LBA48 = 0x25,
+        READ_MULTIPLE_LBA28 = 0xC4,
+        READ_MULTIPLE_LBA48 = 0x29,
         WRITE_PIO_LBA28 = 0x30,
         WRITE_PIO_LBA48 = 0x34,
         WRITE_DMA_LBA28 = 0xCA,
         WRITE_DMA_LBA48 = 0x35,
+        WRITE_MULTIPLE_LBA28 = 0xC5,
+        WRITE_MULTIPLE_LBA48 = 0x39,
+        SET_MULTIPLE_MODE = 0xC6,
         EXECUTE_DRIVE_DIAGNOSE = 0x90,
         FLUSH_CACHE = 0xE7,
         IDENTIFY_ATA_DRIVE = 0xEC,
@@ -165,6 +172,7 @@ private:
         SERIAL = 10,
         FIRMWARE = 23,
         MODEL = 27,
+        MULTIPLE_SECTORS = 47,
         CAPABILITIES = 49,
         VALID = 53,
         MAX_LBA = 60,
@@ -212,6 +220,7 @@ public:
         uint16_t minorVersion;                        // Minor ATA Version supported
         AddressType addressing;                       // CHS (0), LBA28 (1), LBA48 (2)
         uint16_t sectorSize;                          // Sector size
+        uint8_t sectorsPerBlock;                      // Sectors per data request with READ/WRITE MULTIPLE (1, if not supported)
         AtapiValues atapi;                            // In case of ATAPI, more information about the drive
 
         [[nodiscard]] bool supportsDma() const;
@@ -268,11 +277,22 @@ private:
         Device::IoPort address;     // base + 0x04 (read/write)
     };
     
+    struct PhysicalRegionDescriptor {
+        uint32_t address;
+        uint16_t byteCount;
+        uint16_t flags;
+    } __attribute__((packed));
+
     struct ChannelRegisters {
         ChannelRegisters();
         ChannelRegisters(uint16_t commandBaseAddress, uint16_t controlBaseAddress, uint16_t dmaBaseAddress);
 
         bool receivedInterrupt = false;         // Currently received interrupt
+        uint8_t driveStatus = 0;                // Drive status, read when the last interrupt has been received
+        uint8_t dmaStatus = 0;                  // Bus master status, read when the last interrupt has been received
+        PhysicalRegionDescriptor *prdt = nullptr; // Physical region descriptor table for DMA transfers
+        uint32_t prdtPhysical = 0;              // Physical address of the descriptor table
+        uint8_t *dmaBuffer = nullptr;           // Buffer for DMA transfers (DMA_BUFFER_PAGES pages)
         uint8_t lastDeviceControl = UINT8_MAX;  // Saves current state of deviceControlRegister
         bool interruptsDisabled = false;        // nIEN (No Interrupt);
         DriveType driveType[2]{};               // Initially found drive types;
@@ -293,6 +313,8 @@ private:
 
     bool readAtapiCapacity(uint8_t channel, uint8_t packetLength, uint16_t *buffer);
 
+    bool setMultipleMode(uint8_t channel, uint8_t sectorsPerBlock);
+
     static uint8_t getAtapiType(uint16_t signature);
 
     bool selectDrive(uint8_t channel, uint8_t drive, bool prepareLbaAccess = false, uint8_t lbaHead = 0);
@@ -307,6 +329,8 @@ private:
 
     uint16_t performDmaAtaIO(const DeviceInfo &info, TransferMode mode, uint16_t *buffer, uint64_t startSector, uint16_t sectorCount);
 
+    void measureThroughput(const DeviceInfo &info);
+
     void prepareAtapiIO(uint8_t channel, uint16_t len);
 
     uint16_t performProgrammedAtapiIO(const DeviceInfo &info, TransferMode mode, uint16_t *buffer, uint64_t startSector, uint16_t sectorCount);
@@ -320,6 +344,7 @@ private:
     ChannelRegisters channels[CHANNELS_PER_CONTROLLER]{};
     Util::Async::Spinlock ioLock;
     bool supportsDma = false;
+    bool dmaEnabled = false;
 };
 
 }
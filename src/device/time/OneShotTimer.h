@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_ONESHOTTIMER_H
+#define HHUOS_ONESHOTTIMER_H
+
+#include "lib/util/time/Timestamp.h"
+
+namespace Device {
+
+/**
+ * A timer, which does not fire periodically, but only once after a programmable delay.
+ * Used by the scheduler to wake up exactly at the next time slice end or sleeper wakeup (tickless operation).
+ */
+class OneShotTimer {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    OneShotTimer() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    OneShotTimer(const OneShotTimer &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    OneShotTimer &operator=(const OneShotTimer &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    virtual ~OneShotTimer() = default;
+
+    /**
+     * Arm the timer to fire once after the given delay, replacing the current expiry.
+     */
+    virtual void setNextExpiry(const Util::Time::Timestamp &delay) = 0;
+
+    /**
+     * Get the time left until the timer fires.
+     */
+    [[nodiscard]] virtual Util::Time::Timestamp getRemainingTime() = 0;
+
+    /**
+     * Get the preemption interval, after which the running thread is interrupted, if no sleeper wakes up earlier.
+     */
+    [[nodiscard]] virtual Util::Time::Timestamp getTimeSlice() const = 0;
+};
+
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "kernel/service/Service.h"
 #include "kernel/service/ProcessService.h"
 #include "kernel/process/Scheduler.h"
+#include "kernel/process/Profiler.h"
 #include "kernel/service/TimeService.h"
 
 namespace Kernel {
@@ -38,14 +39,18 @@ namespace Device {
 
 uint32_t ApicTimer::BASE_FREQUENCY = 0;
 
-ApicTimer::ApicTimer(Util::Time::Timestamp timerInterval, Util::Time::Timestamp yieldInterval) : cpuId(LocalApic::getId()), timerInterval(timerInterval), yieldInterval(yieldInterval) {
+ApicTimer::ApicTimer(Util::Time::Timestamp timerInterval, Util::Time::Timestamp yieldInterval, bool oneShot) : cpuId(LocalApic::getId()), oneShot(oneShot), timerInterval(timerInterval), yieldInterval(yieldInterval) {
     auto counter = (BASE_FREQUENCY / 1000) * timerInterval.toMilliseconds();
-    LOG_INFO("Setting APIC timer [%u] interval to [%ums] (Counter: [%u])", cpuId, static_cast<uint32_t>(timerInterval.toMilliseconds()), static_cast<uint32_t>(counter));
+    if (oneShot) {
+        LOG_INFO("Setting APIC timer [%u] to one-shot mode (Maximum time slice: [%ums])", cpuId, static_cast<uint32_t>(yieldInterval.toMilliseconds()));
+    } else {
+        LOG_INFO("Setting APIC timer [%u] interval to [%ums] (Counter: [%u])", cpuId, static_cast<uint32_t>(timerInterval.toMilliseconds()), static_cast<uint32_t>(counter));
+    }
 
     // Recommended order: Divide -> LVT -> Initial Count (OSDev)
     LocalApic::writeDoubleWord(LocalApic::TIMER_DIVIDE, Divider::BY_1);
     LocalApic::LocalVectorTableEntry lvtEntry = LocalApic::readLocalVectorTable(LocalApic::TIMER);
-    lvtEntry.timerMode = LocalApic::LocalVectorTableEntry::TimerMode::PERIODIC;
+    lvtEntry.timerMode = oneShot ? LocalApic::LocalVectorTableEntry::TimerMode::ONESHOT : LocalApic::LocalVectorTableEntry::TimerMode::PERIODIC;
     LocalApic::writeLocalVectorTable(LocalApic::TIMER, lvtEntry);
     LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, counter);
 }
@@ -63,6 +68,23 @@ void ApicTimer::trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptVe
         return;
     }
 
+    // Sample before yielding, so that the sample belongs to the interrupted thread
+    Kernel::Profiler::sample(frame, cpuId);
+
+    if (oneShot) {
+        // There is no fixed interval between interrupts in one-shot mode -> Take the time from the system clocksource
+        time = Kernel::Service::getService<Kernel::TimeService>().getSystemTime();
+        if (cpuId != 0) {
+            return;
+        }
+
+        // Arm the timer before yielding, since the yield only returns, once this thread is scheduled again
+        auto &scheduler = Kernel::Service::getService<Kernel::ProcessService>().getScheduler();
+        setNextExpiry(scheduler.getTimeUntilNextWakeup(yieldInterval));
+        scheduler.yield();
+        return;
+    }
+
     // Increase the "core-local" time, the system time is still managed by the PIT.
     time += timerInterval;
 
@@ -85,6 +107,36 @@ Util::Time::Timestamp ApicTimer::getTime() {
     return time;
 }
 
+void ApicTimer::setNextExpiry(const Util::Time::Timestamp &delay) {
+    if (!oneShot) {
+        return;
+    }
+
+    // Delays of 4 seconds or more exceed the 32-bit counter at any realistic frequency (and would overflow the calculation)
+    auto counter = delay.toSeconds() >= 4 ? UINT32_MAX : (static_cast<uint64_t>(BASE_FREQUENCY) * delay.toNanoseconds()) / 1000000000;
+    if (counter < MIN_COUNTER) {
+        counter = MIN_COUNTER;
+    } else if (counter > UINT32_MAX) {
+        counter = UINT32_MAX;
+    }
+
+    // Writing the initial count register restarts the timer
+    LocalApic::writeDoubleWord(LocalApic::TIMER_INITIAL, static_cast<uint32_t>(counter));
+}
+
+Util::Time::Timestamp ApicTimer::getRemainingTime() {
+    auto counter = LocalApic::readDoubleWord(LocalApic::TIMER_CURRENT);
+    return Util::Time::Timestamp::ofNanoseconds((static_cast<uint64_t>(counter) * 1000000000) / BASE_FREQUENCY);
+}
+
+Util::Time::Timestamp ApicTimer::getTimeSlice() const {
+    return yieldInterval;
+}
+
+bool ApicTimer::isOneShot() const {
+    return oneShot;
+}
+
 void ApicTimer::calibrate() {
     if (BASE_FREQUENCY != 0) {
         return; // Timer is already calibrated
@@ -25,6 +25,7 @@
 
 #include "kernel/interrupt/InterruptHandler.h"
 #include "device/time/TimeProvider.h"
+#include "device/time/OneShotTimer.h"
 #include "lib/util/time/Timestamp.h"
 
 namespace Kernel {
@@ -43,7 +44,7 @@ namespace Device {
  * It receives its tick interval in milliseconds, which should be precise enough for scheduling.
  * If a more precise interval is required, the timer divider might need adjustment.
  */
-class ApicTimer : public Kernel::InterruptHandler, public TimeProvider {
+class ApicTimer : public Kernel::InterruptHandler, public TimeProvider, public OneShotTimer {
 
 public:
     /**
@@ -71,8 +72,9 @@ public:
      *
      * @param timerInterval The tick interval in milliseconds (10 milliseconds by default)
      * @param yieldInterval The preemption interval in milliseconds (10 milliseconds by default)
+     * @param oneShot Fire only once per programmed expiry (see setNextExpiry()) instead of periodically
      */
-    ApicTimer(Util::Time::Timestamp timerInterval, Util::Time::Timestamp yieldInterval);
+    ApicTimer(Util::Time::Timestamp timerInterval, Util::Time::Timestamp yieldInterval, bool oneShot = false);
 
     /**
      * Copy Constructor.
@@ -104,6 +106,24 @@ public:
      */
     [[nodiscard]] Util::Time::Timestamp getTime() override;
 
+    /**
+     * Overriding function from OneShotTimer.
+     * Only has an effect, if the timer has been created in one-shot mode.
+     */
+    void setNextExpiry(const Util::Time::Timestamp &delay) override;
+
+    /**
+     * Overriding function from OneShotTimer.
+     */
+    [[nodiscard]] Util::Time::Timestamp getRemainingTime() override;
+
+    /**
+     * Overriding function from OneShotTimer.
+     */
+    [[nodiscard]] Util::Time::Timestamp getTimeSlice() const override;
+
+    [[nodiscard]] bool isOneShot() const;
+
     /**
      * Calibrate the APIC timer using the PIT.
      *
@@ -116,6 +136,7 @@ public:
 
 private:
     uint8_t cpuId;          // The id of the CPU that uses this timer.
+    bool oneShot;           // In one-shot mode, the scheduler programs each expiry instead of using a periodic tick.
     Util::Time::Timestamp timerInterval; // The interrupt trigger interval in milliseconds.
     Util::Time::Timestamp yieldInterval; // The preemption trigger interval in milliseconds.
     Util::Time::Timestamp timeSinceLastYield;
@@ -123,6 +144,8 @@ private:
     Util::Time::Timestamp time{}; // The "core-local" timestamp.
 
     static uint32_t BASE_FREQUENCY; // The number of ticks the APIC timer does in 1 second
+
+    static const constexpr uint32_t MIN_COUNTER = 100; // Shorter delays are rounded up, so that the interrupt does not fire before the handler returns
 };
 
 }
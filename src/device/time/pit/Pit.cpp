@@ -24,6 +24,9 @@
 #include "kernel/service/Service.h"
 #include "kernel/service/ProcessService.h"
 #include "kernel/process/Scheduler.h"
+#include "kernel/process/Profiler.h"
+#include "kernel/service/TimeService.h"
+#include "lib/util/time/TimePage.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -61,7 +64,13 @@ void Pit::plugin() {
 void Pit::trigger(const Kernel::InterruptFrame &frame, Kernel::InterruptVector slot) {
     time += timerInterval;
 
+    // Publish the coarse system time for user space (ignored if a TSC clocksource is used)
+    Kernel::Service::getService<Kernel::TimeService>().getTimePage().setTime(time);
+
     if (!Kernel::Service::getService<Kernel::InterruptService>().usesApic()) {
+        // Without APIC, the PIT drives the sampling profiler (sample before yielding, so that the sample belongs to the interrupted thread)
+        Kernel::Profiler::sample(frame, 0);
+
         timeSinceLastYield += timerInterval;
         if (timeSinceLastYield > yieldInterval) {
             timeSinceLastYield = Util::Time::Timestamp::ofMilliseconds(0);
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Tsc.h"
+
+#include "device/time/WaitTimer.h"
+#include "kernel/log/Log.h"
+#include "lib/util/base/Exception.h"
+#include "lib/util/hardware/CpuId.h"
+#include "lib/util/time/TimePage.h"
+
+namespace Device {
+
+Tsc::Tsc(WaitTimer &calibrationTimer) {
+    if (!isAvailable()) {
+        Util::Exception::throwException(Util::Exception::UNSUPPORTED_OPERATION, "Trying to initialize unavailable TSC!");
+    }
+
+    // Take the minimum of several rounds, since the overhead of the wait timer can only make a round longer
+    uint64_t minCycles = UINT64_MAX;
+    for (uint32_t i = 0; i < CALIBRATION_ROUNDS; i++) {
+        auto start = Util::Time::TimePage::readTsc();
+        calibrationTimer.wait(Util::Time::Timestamp::ofMilliseconds(CALIBRATION_MILLISECONDS));
+        auto cycles = Util::Time::TimePage::readTsc() - start;
+
+        if (cycles < minCycles) {
+            minCycles = cycles;
+        }
+    }
+
+    frequency = minCycles * (1000 / CALIBRATION_MILLISECONDS);
+
+    // Use the highest precision, for which the multiplier still fits into 32 bits
+    shift = 32;
+    auto scaledMultiplier = (NANOSECONDS_PER_SECOND << shift) / frequency;
+    while (scaledMultiplier > UINT32_MAX) {
+        shift--;
+        scaledMultiplier = (NANOSECONDS_PER_SECOND << shift) / frequency;
+    }
+
+    multiplier = static_cast<uint32_t>(scaledMultiplier);
+    tscBase = Util::Time::TimePage::readTsc();
+
+    LOG_INFO("TSC frequency: [%u MHz] (Multiplier: [%u], Shift: [%u])", static_cast<uint32_t>(frequency / 1000000), multiplier, shift);
+}
+
+bool Tsc::isAvailable() {
+    return Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuFeatureBits() & Util::Hardware::CpuId::TSC) != 0;
+}
+
+Util::Time::Timestamp Tsc::getTime() {
+    auto cycles = Util::Time::TimePage::readTsc() - tscBase;
+    return Util::Time::Timestamp::ofNanoseconds(Util::Time::TimePage::scaleTsc(cycles, multiplier, shift));
+}
+
+uint64_t Tsc::getFrequency() const {
+    return frequency;
+}
+
+void Tsc::publish(Util::Time::TimePage &timePage) const {
+    timePage.setTscClocksource(tscBase, 0, multiplier, shift);
+}
+
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TSC_H
+#define HHUOS_TSC_H
+
+#include <cstdint>
+
+#include "device/time/TimeProvider.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Util {
+namespace Time {
+class TimePage;
+}  // namespace Time
+}  // namespace Util
+
+namespace Device {
+class WaitTimer;
+
+/**
+ * Clocksource based on the time stamp counter.
+ * The TSC frequency is calibrated against another timer (ACPI timer or PIT) once during initialization.
+ * Afterwards, reading the time only requires the 'rdtsc' instruction and a fixed point multiplication,
+ * which can also be done in user space via the time page (see Util::Time::TimePage).
+ */
+class Tsc : public TimeProvider {
+
+public:
+    /**
+     * Constructor.
+     * Calibrates the TSC frequency by busy waiting with the given timer.
+     */
+    explicit Tsc(WaitTimer &calibrationTimer);
+
+    /**
+     * Copy Constructor.
+     */
+    Tsc(const Tsc &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Tsc &operator=(const Tsc &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Tsc() override = default;
+
+    [[nodiscard]] static bool isAvailable();
+
+    [[nodiscard]] Util::Time::Timestamp getTime() override;
+
+    [[nodiscard]] uint64_t getFrequency() const;
+
+    /**
+     * Publish the scaling factors in the given time page, so that user space can read the time without a system call.
+     */
+    void publish(Util::Time::TimePage &timePage) const;
+
+private:
+
+    uint64_t frequency = 0;
+    uint64_t tscBase = 0;
+    uint32_t multiplier = 0;
+    uint32_t shift = 0;
+
+    static const constexpr uint32_t CALIBRATION_ROUNDS = 3;
+    static const constexpr uint32_t CALIBRATION_MILLISECONDS = 10;
+    static const constexpr uint64_t NANOSECONDS_PER_SECOND = 1000000000;
+};
+
+}
+
+#endif
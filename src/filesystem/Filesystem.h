@@ -182,7 +182,7 @@ private:
 
     Util::HashMap<Util::String, Driver*> mountPoints;
     Util::HashMap<Util::String, MountInformation> mountInformation;
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReentrantSpinlock lock{"Filesystem"};
 };
 
 }
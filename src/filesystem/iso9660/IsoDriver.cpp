@@ -26,6 +26,7 @@
 #include "device/storage/StorageDevice.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/collection/Iterator.h"
+#include "lib/util/collection/HashMap.h"
 
 namespace Filesystem {
 class Node;
@@ -33,18 +34,15 @@ class Node;
 
 namespace Filesystem::Iso {
 
-bool IsoDriver::mount(Device::Storage::StorageDevice &device) {
-    IsoDriver::device = &device;
-
-    if (!initializePrimaryVolumeDescriptor()) {
-        return false;
-    }
-
-    if (!initializePathTable()) {
-        return false;
+IsoDriver::~IsoDriver() {
+    for (auto *directory : directoryCache.values()) {
+        delete directory;
     }
+}
 
-    return true;
+bool IsoDriver::mount(Device::Storage::StorageDevice &device) {
+    IsoDriver::device = &device;
+    return initializePrimaryVolumeDescriptor();
 }
 
 bool IsoDriver::createFilesystem(Device::Storage::StorageDevice &device) {
@@ -52,77 +50,32 @@ bool IsoDriver::createFilesystem(Device::Storage::StorageDevice &device) {
 }
 
 Node* IsoDriver::getNode(const Util::String &path) {
-    // Directories are linked in reverse order (child to parent) in the path table list.
-    // To find the directory, holding the searched file, we split the path and search for deepest directory
     auto pathSegments = path.split(Util::Io::File::SEPARATOR);
-    auto nodeName = pathSegments.length() == 0 ? "" : pathSegments[pathSegments.length() - 1];
+    const auto &rootRecord = *reinterpret_cast<const DirectoryRecord*>(primaryVolumeDescriptor.rootDirectoryEntry);
 
-    const auto *entry = pathTableEntryList.get(0); // Root directory is always at index 0
-    for (uint32_t i = 0; i < pathSegments.length(); i++) {
-        const auto &currentName = pathSegments[i];
+    auto *directory = getDirectory(rootRecord);
 
-        for (const auto *currentEntry : pathTableEntryList) {
-            if (currentEntry->getName() == currentName) {
-                entry = currentEntry;
-            }
+    // Walk down the directory tree, looking up each segment in the cached record index of its parent directory
+    for (uint32_t i = 0; directory != nullptr && i < pathSegments.length(); i++) {
+        if (!directory->records.containsKey(pathSegments[i])) {
+            return nullptr;
         }
-    }
 
-    // Read single sector at extent address
-    auto *buffer = new uint8_t[device->getSectorSize()];
-    auto readSectors = device->read(buffer, entry->extentLba, 1);
-    if (readSectors != 1) {
-        delete[] buffer;
-        return nullptr;
-    }
-
-    // First record describes the directory itself
-    const auto &selfRecord = *reinterpret_cast<DirectoryRecord*>(buffer);
-    if (pathSegments.length() == 0 || entry->getName() == pathSegments[pathSegments.length() - 1]) {
-        // The requested node is the directory itself
-        auto *node = new IsoNode(*device, selfRecord.createCopy());
-
-        delete[] buffer;
-        return node;
-    }
-
-    if (selfRecord.dataLengthLSB > device->getSectorSize()) {
-        // Directory tables spans more than one sector -> Read whole table
-        uint8_t sectorCount = (selfRecord.dataLengthLSB % device->getSectorSize() == 0) ? (selfRecord.dataLengthLSB / device->getSectorSize()) : (selfRecord.dataLengthLSB / device->getSectorSize() + 1);
-        delete[] buffer;
-        buffer = new uint8_t[sectorCount * device->getSectorSize()];
-
-        readSectors = device->read(buffer, entry->extentLba, sectorCount);
-        if (readSectors != sectorCount) {
-            delete[] buffer;
-            return nullptr;
+        const auto *record = directory->records.get(pathSegments[i]);
+        if (i == pathSegments.length() - 1) {
+            // We found the searched record -> Create and return Node instance
+            return new IsoNode(*this, *device, record->createCopy());
         }
-    }
 
-    uint32_t index = 0;
-    while (index < selfRecord.dataLengthLSB) {
-        const auto &record = *reinterpret_cast<DirectoryRecord*>(buffer + index);
-        if (record.recordLength == 0) {
-            // Skip padding bytes by aligning index to next sector
-            index = ((index + device->getSectorSize()) / device->getSectorSize()) * device->getSectorSize();
-        } else {
-            // Skip self and parent referencing records
-            if (!(record.identifierLength == 1 && (record.identifier[0] == 0x00 || record.identifier[0] == 0x01))) {
-                // Record is valid
-                if (record.getName() == pathSegments[pathSegments.length() - 1]) {
-                    // We found the searched record -> Create and return Node instance
-                    auto *node = new IsoNode(*device, record.createCopy());
-
-                    delete[] buffer;
-                    return node;
-                }
-            }
+        directory = record->isDirectory() ? getDirectory(*record) : nullptr;
+    }
 
-            index += record.recordLength;
-        }
+    if (directory == nullptr) {
+        return nullptr;
     }
 
-    return nullptr;
+    // The requested node is the root directory itself
+    return new IsoNode(*this, *device, directory->self->createCopy());
 }
 
 bool IsoDriver::createNode(const Util::String &path, Util::Io::File::Type type) {
@@ -161,47 +114,83 @@ bool IsoDriver::initializePrimaryVolumeDescriptor() {
     return true;
 }
 
-bool IsoDriver::initializePathTable() {
-    uint8_t sectorCount = (primaryVolumeDescriptor.pathTableSizeLSB % device->getSectorSize() == 0) ? (primaryVolumeDescriptor.pathTableSizeLSB / device->getSectorSize()) : (primaryVolumeDescriptor.pathTableSizeLSB / device->getSectorSize() + 1);
-    auto *buffer = new uint8_t[sectorCount * device->getSectorSize()];
+Util::Array<Util::String> IsoDriver::getChildren(const DirectoryRecord &directory) {
+    auto *parsedDirectory = getDirectory(directory);
+    return parsedDirectory == nullptr ? Util::Array<Util::String>(0) : parsedDirectory->names;
+}
 
-    auto readSectors = device->read(buffer, primaryVolumeDescriptor.pathTableLbaLSB, sectorCount);
+IsoDriver::Directory* IsoDriver::getDirectory(const DirectoryRecord &record) {
+    cacheLock.acquire();
+    if (directoryCache.containsKey(record.extentLbaLSB)) {
+        return cacheLock.releaseAndReturn(directoryCache.get(record.extentLbaLSB));
+    }
+
+    // Read and parse the extent without holding the lock, so that lookups of cached directories do not wait for the device
+    cacheLock.release();
+
+    auto sectorSize = device->getSectorSize();
+    auto sectorCount = (record.dataLengthLSB % sectorSize == 0) ? (record.dataLengthLSB / sectorSize) : (record.dataLengthLSB / sectorSize + 1);
+    auto *buffer = new uint8_t[sectorCount * sectorSize];
+
+    auto readSectors = device->read(buffer, record.extentLbaLSB, sectorCount);
     if (readSectors != sectorCount) {
         delete[] buffer;
-        return false;
+        return nullptr;
     }
 
+    auto validRecords = Util::ArrayList<const DirectoryRecord*>();
+    const DirectoryRecord *selfRecord = nullptr;
+
     uint32_t index = 0;
-    while (index < primaryVolumeDescriptor.pathTableSizeLSB) {
-        const auto &entry = *reinterpret_cast<PathTableEntry*>(buffer + index);
+    while (index < record.dataLengthLSB) {
+        const auto &currentRecord = *reinterpret_cast<DirectoryRecord*>(buffer + index);
+        if (currentRecord.recordLength == 0) {
+            // Skip padding bytes by aligning index to next sector
+            index = ((index + sectorSize) / sectorSize) * sectorSize;
+        } else {
+            if (currentRecord.identifierLength == 1 && currentRecord.identifier[0] == 0x00) {
+                // First record describes the directory itself
+                selfRecord = &currentRecord;
+            } else if (!(currentRecord.identifierLength == 1 && currentRecord.identifier[0] == 0x01)) {
+                // Skip parent referencing record
+                validRecords.add(&currentRecord);
+            }
 
-        // Copy entry manually for use in ArrayList, because its size is dynamic
-        pathTableEntryList.add(entry.createCopy());
+            index += currentRecord.recordLength;
+        }
+    }
+
+    auto *directory = new Directory(validRecords.size());
+    directory->self = selfRecord == nullptr ? record.createCopy() : selfRecord->createCopy();
+    for (uint32_t i = 0; i < validRecords.size(); i++) {
+        auto *copy = validRecords.get(i)->createCopy();
+        auto name = copy->getName();
 
-        index += entry.getLength();
+        directory->names[i] = name;
+        directory->records.put(name, copy);
     }
 
     delete[] buffer;
-    return true;
-}
-
-Util::String IsoDriver::PathTableEntry::getName() const {
-    return Util::String(reinterpret_cast<const uint8_t*>(directoryIdentifier), directoryIdentifierLength);
-}
 
-bool IsoDriver::PathTableEntry::operator!=(const IsoDriver::PathTableEntry &other) const {
-    return extentLba != other.extentLba;
-}
+    cacheLock.acquire();
+    if (directoryCache.containsKey(record.extentLbaLSB)) {
+        // Another thread has read the same directory in the meantime -> Keep the cached one, since it may already be in use
+        delete directory;
+        directory = directoryCache.get(record.extentLbaLSB);
+    } else {
+        directoryCache.put(record.extentLbaLSB, directory);
+    }
 
-uint32_t IsoDriver::PathTableEntry::getLength() const {
-    return 8 + directoryIdentifierLength + (directoryIdentifierLength % 2 == 0 ? 0 : 1);
+    return cacheLock.releaseAndReturn(directory);
 }
 
-IsoDriver::PathTableEntry* IsoDriver::PathTableEntry::createCopy() const {
-    auto copyBuffer = new uint8_t[getLength()];
-    Util::Address<uint32_t>(copyBuffer).copyRange(Util::Address<uint32_t>(this), getLength());
+IsoDriver::Directory::Directory(uint32_t recordCount) : names(recordCount), records(recordCount * 2 + 1) {}
 
-    return reinterpret_cast<PathTableEntry*>(copyBuffer);
+IsoDriver::Directory::~Directory() {
+    delete[] reinterpret_cast<uint8_t*>(self);
+    for (auto *record : records.values()) {
+        delete[] reinterpret_cast<uint8_t*>(record);
+    }
 }
 
 Util::String IsoDriver::DirectoryRecord::getName() const {
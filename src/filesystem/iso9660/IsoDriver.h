@@ -25,6 +25,8 @@
 
 #include "filesystem/PhysicalDriver.h"
 #include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/async/Spinlock.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 #include "lib/util/reflection/Prototype.h"
@@ -104,7 +106,7 @@ public:
     /**
      * Destructor.
      */
-    ~IsoDriver() override = default;
+    ~IsoDriver() override;
 
     PROTOTYPE_IMPLEMENT_CLONE(IsoDriver);
 
@@ -135,6 +137,15 @@ public:
      */
     bool deleteNode(const Util::String &path) override;
 
+    /**
+     * Get the names of all files and directories inside the given directory.
+     * The directory's records are parsed only once and served from the directory cache afterwards.
+     *
+     * @param directory The directory record
+     * @return The names of all children
+     */
+    Util::Array<Util::String> getChildren(const DirectoryRecord &directory);
+
 private:
 
     enum VolumeDescriptorType : uint8_t {
@@ -202,31 +213,40 @@ private:
         uint8_t reserved[653];
     } __attribute__((packed));
 
-    struct PathTableEntry {
-        uint8_t directoryIdentifierLength;              // Length of the directory identifier
-        uint8_t extendedAttributeRecordLength;          // Length of the extended attribute record
-        uint32_t extentLba;                             // LBA address of Extent
-        uint16_t parentDirectoryIndex;                  // Path Table entry index for parent directory
-        char directoryIdentifier[];                     // Directory identifier
-
-        [[nodiscard]] uint32_t getLength() const;
-
-        [[nodiscard]] Util::String getName() const;
+    /**
+     * Parsed contents of a directory extent.
+     * ISO 9660 media are read-only, so a directory never changes once it has been read.
+     */
+    struct Directory {
+        explicit Directory(uint32_t recordCount);
 
-        [[nodiscard]] PathTableEntry* createCopy() const;
+        ~Directory();
 
-        bool operator!=(const PathTableEntry &other) const;
-    } __attribute__((packed));
+        DirectoryRecord *self = nullptr;
+        Util::Array<Util::String> names;
+        Util::HashMap<Util::String, DirectoryRecord*> records;
+    };
 
     bool initializePrimaryVolumeDescriptor();
 
-    bool initializePathTable();
+    /**
+     * Get the parsed directory, described by the given record.
+     * On a cache miss, the whole directory extent is read with a single request and all records are indexed by name.
+     * The cache lock is only held while accessing the cache, not while reading from the device.
+     * Cached directories are never modified or removed (until the driver is destroyed), so they can be used without locking.
+     *
+     * @return The parsed directory or nullptr, if the extent could not be read
+     */
+    Directory* getDirectory(const DirectoryRecord &record);
 
 private:
 
     Device::Storage::StorageDevice *device = nullptr;
     PrimaryVolumeDescriptor primaryVolumeDescriptor{};
-    Util::ArrayList<PathTableEntry*> pathTableEntryList = Util::ArrayList<PathTableEntry*>();
+    Util::HashMap<uint32_t, Directory*> directoryCache = Util::HashMap<uint32_t, Directory*>(DIRECTORY_CACHE_TABLE_SIZE);
+    Util::Async::Spinlock cacheLock;
+
+    static const constexpr uint32_t DIRECTORY_CACHE_TABLE_SIZE = 251;
 
     static const constexpr uint16_t VOLUME_DESCRIPTORS_START_SECTOR = 16;
 };
@@ -23,11 +23,10 @@
 #include "lib/util/base/Address.h"
 #include "device/storage/StorageDevice.h"
 #include "filesystem/iso9660/IsoDriver.h"
-#include "lib/util/collection/ArrayList.h"
 
 namespace Filesystem::Iso {
 
-IsoNode::IsoNode(Device::Storage::StorageDevice &device, const IsoDriver::DirectoryRecord *record) : device(device), record(*record) {}
+IsoNode::IsoNode(IsoDriver &driver, Device::Storage::StorageDevice &device, const IsoDriver::DirectoryRecord *record) : driver(driver), device(device), record(*record) {}
 
 IsoNode::~IsoNode() {
     delete &record;
@@ -46,35 +45,7 @@ Util::Io::File::Type IsoNode::getType() {
 }
 
 Util::Array<Util::String> IsoNode::getChildren() {
-    uint8_t sectorCount = (record.dataLengthLSB % device.getSectorSize() == 0) ? (record.dataLengthLSB / device.getSectorSize()) : (record.dataLengthLSB / device.getSectorSize() + 1);
-    auto buffer = new uint8_t[sectorCount * device.getSectorSize()];
-
-    auto readSectors = device.read(buffer, record.extentLbaLSB, sectorCount);
-    if (readSectors != sectorCount) {
-        delete[] buffer;
-        return Util::Array<Util::String>(0);
-    }
-
-    auto names = Util::ArrayList<Util::String>();
-
-    uint32_t index = 0;
-    while (index < record.dataLengthLSB) {
-        const auto &currentRecord = *reinterpret_cast<IsoDriver::DirectoryRecord*>(buffer + index);
-        if (currentRecord.recordLength == 0) {
-            // Skip padding bytes by aligning index to next sector
-            index = ((index + device.getSectorSize()) / device.getSectorSize()) * device.getSectorSize();
-        } else {
-            // Skip self and parent referencing records
-            if (!(currentRecord.identifierLength == 1 && (currentRecord.identifier[0] == 0x00 || currentRecord.identifier[0] == 0x01))) {
-                // Record is valid -> Add name to list
-                names.add(currentRecord.getName());
-            }
-
-            index += currentRecord.recordLength;
-        }
-    }
-
-    return names.toArray();
+    return driver.getChildren(record);
 }
 
 uint64_t IsoNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
@@ -86,22 +57,53 @@ uint64_t IsoNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numByte
         numBytes = (record.dataLengthLSB - pos);
     }
 
-    uint32_t startSector = record.extentLbaLSB + (static_cast<uint32_t>(pos) / device.getSectorSize());
-    uint32_t sectorCount = (static_cast<uint32_t>(numBytes) / device.getSectorSize()) + 1;
+    // Files are stored in a single contiguous extent -> Whole sectors are read directly into the target buffer with one request,
+    // only partially requested sectors at the beginning and the end are read into a bounce buffer
+    auto sectorSize = device.getSectorSize();
+    auto startSector = record.extentLbaLSB + static_cast<uint32_t>(pos / sectorSize);
+    auto offset = static_cast<uint32_t>(pos % sectorSize);
+    uint64_t bytesRead = 0;
+    uint8_t *sectorBuffer = nullptr;
+
+    if (offset != 0 || numBytes < sectorSize) {
+        sectorBuffer = new uint8_t[sectorSize];
+        if (device.read(sectorBuffer, startSector, 1) != 1) {
+            delete[] sectorBuffer;
+            return 0;
+        }
 
-    auto *buffer = new uint8_t[sectorCount * device.getSectorSize()];
-    auto readSectors = device.read(buffer, startSector, sectorCount);
-    if (readSectors != sectorCount) {
-        delete[] buffer;
-        return 0;
+        bytesRead = sectorSize - offset > numBytes ? numBytes : sectorSize - offset;
+        Util::Address<uint32_t>(targetBuffer).copyRange(Util::Address<uint32_t>(sectorBuffer).add(offset), bytesRead);
+        startSector++;
     }
 
-    auto sourceAddress = Util::Address<uint32_t>(buffer).add(static_cast<uint32_t>(pos) % device.getSectorSize());
-    auto targetAddress = Util::Address<uint32_t>(targetBuffer);
-    targetAddress.copyRange(sourceAddress, numBytes);
+    auto fullSectors = static_cast<uint32_t>((numBytes - bytesRead) / sectorSize);
+    if (fullSectors > 0) {
+        if (device.read(targetBuffer + bytesRead, startSector, fullSectors) != fullSectors) {
+            delete[] sectorBuffer;
+            return bytesRead;
+        }
+
+        bytesRead += static_cast<uint64_t>(fullSectors) * sectorSize;
+        startSector += fullSectors;
+    }
+
+    if (bytesRead < numBytes) {
+        if (sectorBuffer == nullptr) {
+            sectorBuffer = new uint8_t[sectorSize];
+        }
+
+        if (device.read(sectorBuffer, startSector, 1) != 1) {
+            delete[] sectorBuffer;
+            return bytesRead;
+        }
+
+        Util::Address<uint32_t>(targetBuffer + bytesRead).copyRange(Util::Address<uint32_t>(sectorBuffer), numBytes - bytesRead);
+        bytesRead = numBytes;
+    }
 
-    delete[] buffer;
-    return numBytes;
+    delete[] sectorBuffer;
+    return bytesRead;
 }
 
 uint64_t IsoNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
@@ -43,7 +43,7 @@ public:
     /**
      * Constructor.
      */
-    explicit IsoNode(Device::Storage::StorageDevice &device, const IsoDriver::DirectoryRecord *record);
+    IsoNode(IsoDriver &driver, Device::Storage::StorageDevice &device, const IsoDriver::DirectoryRecord *record);
 
     /**
      * Copy Constructor.
@@ -92,6 +92,7 @@ public:
 
 private:
 
+    IsoDriver &driver;
     Device::Storage::StorageDevice &device;
     const IsoDriver::DirectoryRecord &record;
 };
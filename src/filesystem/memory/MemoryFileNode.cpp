@@ -16,6 +16,7 @@
  */
 
 #include "lib/util/base/Address.h"
+#include "lib/util/base/Constants.h"
 #include "MemoryFileNode.h"
 #include "filesystem/memory/MemoryNode.h"
 
@@ -23,6 +24,11 @@ namespace Filesystem::Memory {
 
 MemoryFileNode::MemoryFileNode(const Util::String &name) : MemoryNode(name) {}
 
+MemoryFileNode::~MemoryFileNode() {
+    releasePages(0);
+    delete[] pages;
+}
+
 Util::Io::File::Type MemoryFileNode::getType() {
     return Util::Io::File::REGULAR;
 }
@@ -44,34 +50,127 @@ uint64_t MemoryFileNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t
         numBytes = (length - pos);
     }
 
-    auto sourceAddress = Util::Address<uint32_t>(data).add(pos);
-    auto targetAddress = Util::Address<uint32_t>(targetBuffer);
-    targetAddress.copyRange(sourceAddress, numBytes);
+    uint64_t bytesRead = 0;
+    while (bytesRead < numBytes) {
+        auto pageIndex = static_cast<uint32_t>((pos + bytesRead) / Util::PAGESIZE);
+        auto pageOffset = static_cast<uint32_t>((pos + bytesRead) % Util::PAGESIZE);
+        auto chunkSize = Util::PAGESIZE - pageOffset;
+        if (chunkSize > numBytes - bytesRead) {
+            chunkSize = numBytes - bytesRead;
+        }
+
+        auto targetAddress = Util::Address<uint32_t>(targetBuffer + bytesRead);
+        if (pageIndex < pageTableCapacity && pages[pageIndex] != nullptr) {
+            targetAddress.copyRange(Util::Address<uint32_t>(pages[pageIndex] + pageOffset), chunkSize);
+        } else {
+            // Sparse hole -> Read as zeros
+            targetAddress.setRange(0, chunkSize);
+        }
+
+        bytesRead += chunkSize;
+    }
 
     return numBytes;
 }
 
 uint64_t MemoryFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
-    auto sourceAddress = Util::Address<uint32_t>(sourceBuffer);
+    if (numBytes == 0) {
+        return 0;
+    }
 
-    if (pos + numBytes >= length) {
-        auto newLength = pos + numBytes;
-        auto *newData = new uint8_t[newLength];
-        auto oldAddress = Util::Address<uint32_t>(data);
-        auto newAddress = Util::Address<uint32_t>(newData);
+    ensurePageTableCapacity(static_cast<uint32_t>((pos + numBytes + Util::PAGESIZE - 1) / Util::PAGESIZE));
+
+    uint64_t bytesWritten = 0;
+    while (bytesWritten < numBytes) {
+        auto pageIndex = static_cast<uint32_t>((pos + bytesWritten) / Util::PAGESIZE);
+        auto pageOffset = static_cast<uint32_t>((pos + bytesWritten) % Util::PAGESIZE);
+        auto chunkSize = Util::PAGESIZE - pageOffset;
+        if (chunkSize > numBytes - bytesWritten) {
+            chunkSize = numBytes - bytesWritten;
+        }
+
+        if (pages[pageIndex] == nullptr) {
+            pages[pageIndex] = new uint8_t[Util::PAGESIZE];
+            // Only clear the parts of the page, which are not overwritten right away
+            auto pageAddress = Util::Address<uint32_t>(pages[pageIndex]);
+            pageAddress.setRange(0, pageOffset);
+            pageAddress.add(pageOffset + chunkSize).setRange(0, Util::PAGESIZE - pageOffset - chunkSize);
+        }
+
+        auto targetAddress = Util::Address<uint32_t>(pages[pageIndex] + pageOffset);
+        targetAddress.copyRange(Util::Address<uint32_t>(sourceBuffer + bytesWritten), chunkSize);
+
+        bytesWritten += chunkSize;
+    }
 
-        newAddress.setRange(0, newLength);
-        newAddress.copyRange(oldAddress, length);
+    if (pos + numBytes > length) {
+        length = pos + numBytes;
+    }
 
-        delete data;
-        data = newData;
+    return numBytes;
+}
+
+bool MemoryFileNode::control(uint32_t request, const Util::Array<uint32_t> &parameters) {
+    switch (request) {
+        case Util::Io::File::TRUNCATE:
+            if (parameters.length() < 1) {
+                return false;
+            }
+
+            truncate(parameters[0]);
+            return true;
+        default:
+            return false;
+    }
+}
+
+void MemoryFileNode::truncate(uint64_t newLength) {
+    if (newLength >= length) {
+        // Growing the file only moves its end; the new range is a sparse hole
         length = newLength;
+        return;
     }
 
-    auto targetAddress = Util::Address<uint32_t>(data).add(pos);
-    targetAddress.copyRange(sourceAddress, numBytes);
+    auto pageCount = static_cast<uint32_t>((newLength + Util::PAGESIZE - 1) / Util::PAGESIZE);
+    releasePages(pageCount);
 
-    return numBytes;
+    // Clear the tail of the last page, so that a later extension reads zeros instead of stale data
+    auto tailOffset = static_cast<uint32_t>(newLength % Util::PAGESIZE);
+    if (tailOffset != 0 && pageCount <= pageTableCapacity && pages[pageCount - 1] != nullptr) {
+        Util::Address<uint32_t>(pages[pageCount - 1] + tailOffset).setRange(0, Util::PAGESIZE - tailOffset);
+    }
+
+    length = newLength;
 }
 
-}
\ No newline at end of file
+void MemoryFileNode::ensurePageTableCapacity(uint32_t pageCount) {
+    if (pageCount <= pageTableCapacity) {
+        return;
+    }
+
+    auto newCapacity = pageTableCapacity == 0 ? 16 : pageTableCapacity;
+    while (newCapacity < pageCount) {
+        newCapacity *= 2;
+    }
+
+    auto **newPages = new uint8_t*[newCapacity];
+    for (uint32_t i = 0; i < pageTableCapacity; i++) {
+        newPages[i] = pages[i];
+    }
+    for (uint32_t i = pageTableCapacity; i < newCapacity; i++) {
+        newPages[i] = nullptr;
+    }
+
+    delete[] pages;
+    pages = newPages;
+    pageTableCapacity = newCapacity;
+}
+
+void MemoryFileNode::releasePages(uint32_t firstPage) {
+    for (uint32_t i = firstPage; i < pageTableCapacity; i++) {
+        delete[] pages[i];
+        pages[i] = nullptr;
+    }
+}
+
+}
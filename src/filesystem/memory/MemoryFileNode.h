@@ -48,7 +48,7 @@ public:
     /**
      * Destructor.
      */
-    ~MemoryFileNode() override = default;
+    ~MemoryFileNode() override;
 
     /**
      * Overriding function from Node.
@@ -75,10 +75,30 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     */
+    bool control(uint32_t request, const Util::Array<uint32_t> &parameters) override;
+
+    /**
+     * Set the file length to the given value.
+     * Pages beyond the new end of the file are released. Extending a file leaves a sparse hole, which reads as zeros.
+     */
+    void truncate(uint64_t newLength);
+
 private:
 
+    /**
+     * Make sure, that the page table can hold at least the given amount of pages.
+     * The table grows geometrically, so appending to a file only copies page pointers in amortized constant time.
+     */
+    void ensurePageTableCapacity(uint32_t pageCount);
+
+    void releasePages(uint32_t firstPage);
+
     uint64_t length = 0;
-    uint8_t *data = nullptr;
+    uint8_t **pages = nullptr;
+    uint32_t pageTableCapacity = 0;
 
 };
 
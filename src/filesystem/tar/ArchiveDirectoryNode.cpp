@@ -1,30 +1,16 @@
 #include "ArchiveDirectoryNode.h"
 
 #include "lib/util/base/Exception.h"
-#include "lib/util/io/file/tar/Archive.h"
 
 namespace Filesystem::Tar {
 
-ArchiveDirectoryNode::ArchiveDirectoryNode(Util::Io::Tar::Archive &archive, const Util::String &path) {
+ArchiveDirectoryNode::ArchiveDirectoryNode(const Util::String &path, const Util::ArrayList<Util::String> &children) : children(children.toArray()) {
     if(path.isEmpty() || path == "/") {
         name = "/";
     } else {
         Util::Array<Util::String> tokens = path.split("/");
         name = tokens[tokens.length() - 1];
     }
-
-    for(const auto &header : archive.getFileHeaders()) {
-        Util::String fullPath = header.filename;
-
-        if(fullPath.beginsWith(path) && fullPath != path) {
-            Util::String subPath = fullPath.substring(path.length(), fullPath.length());
-            Util::String childName = subPath.split("/")[0];
-
-            if(!children.contains(childName)) {
-                children.add(childName);
-            }
-        }
-    }
 }
 
 Util::String ArchiveDirectoryNode::getName() {
@@ -40,7 +26,7 @@ uint64_t ArchiveDirectoryNode::getLength() {
 }
 
 Util::Array<Util::String> ArchiveDirectoryNode::getChildren() {
-    return children.toArray();
+    return children;
 }
 
 uint64_t ArchiveDirectoryNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
@@ -9,14 +9,6 @@
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 
-namespace Util {
-namespace Io {
-namespace Tar {
-class Archive;
-}  // namespace Tar
-}  // namespace File
-}  // namespace Util
-
 namespace Filesystem::Tar {
 
 class ArchiveDirectoryNode : public ArchiveNode {
@@ -24,8 +16,11 @@ class ArchiveDirectoryNode : public ArchiveNode {
 public:
     /**
      * Constructor.
+     *
+     * @param path The directory's path inside the archive
+     * @param children The names of all files and directories, directly contained in this directory
      */
-    ArchiveDirectoryNode(Util::Io::Tar::Archive &archive, const Util::String &path);
+    ArchiveDirectoryNode(const Util::String &path, const Util::ArrayList<Util::String> &children);
 
     /**
      * Copy Constructor.
@@ -75,7 +70,7 @@ public:
 private:
 
     Util::String name;
-    Util::ArrayList<Util::String> children;
+    Util::Array<Util::String> children;
 
 };
 
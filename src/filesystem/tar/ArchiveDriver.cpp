@@ -26,20 +26,54 @@ class Node;
 
 namespace Filesystem::Tar {
 
-ArchiveDriver::ArchiveDriver(Util::Io::Tar::Archive &archive) : archive(archive), fileHeaders(archive.getFileHeaders()) {}
+/**
+ * Find the index of the last '/' in the given path.
+ *
+ * @return The separator's index or the path's length, if the path contains no separator
+ */
+static uint32_t findLastSeparator(const Util::String &path) {
+    for (uint32_t i = path.length(); i > 0; i--) {
+        if (path[i - 1] == '/') {
+            return i - 1;
+        }
+    }
 
-Node *ArchiveDriver::getNode(const Util::String &path) {
-    for(const auto &header : fileHeaders) {
-        Util::String currentPath = header.filename;
+    return path.length();
+}
 
-        if(path == currentPath) {
-            return new ArchiveFileNode(archive, header);
-        }
+ArchiveDriver::ArchiveDriver(Util::Io::Tar::Archive &archive) : archive(archive), fileHeaders(archive.getFileHeaderAddresses()),
+        fileIndex(fileHeaders.length() * 2 + 1), directoryIndex(fileHeaders.length() + 1) {
+    addDirectory("");
 
-        if((path == "") || (currentPath.beginsWith(path) && currentPath[path.length()] == '/')) {
-            return new ArchiveDirectoryNode(archive, path);
+    for (auto *header : fileHeaders) {
+        auto path = Util::String(header->filename);
+        auto separator = findLastSeparator(path);
+
+        fileIndex.put(path, header);
+        if (separator < path.length()) {
+            addDirectory(path.substring(0, separator)).add(path.substring(separator + 1));
+        } else {
+            addDirectory("").add(path);
         }
     }
+}
+
+ArchiveDriver::~ArchiveDriver() {
+    for (auto *children : directoryIndex.values()) {
+        delete children;
+    }
+}
+
+Node *ArchiveDriver::getNode(const Util::String &path) {
+    const auto &key = path == "/" ? Util::String() : path;
+
+    if (fileIndex.containsKey(key)) {
+        return new ArchiveFileNode(*fileIndex.get(key));
+    }
+
+    if (directoryIndex.containsKey(key)) {
+        return new ArchiveDirectoryNode(key, *directoryIndex.get(key));
+    }
 
     return nullptr;
 }
@@ -51,4 +85,24 @@ bool ArchiveDriver::createNode(const Util::String &path, Util::Io::File::Type ty
 bool ArchiveDriver::deleteNode(const Util::String &path) {
     return false;
 }
+
+Util::ArrayList<Util::String>& ArchiveDriver::addDirectory(const Util::String &path) {
+    if (directoryIndex.containsKey(path)) {
+        return *directoryIndex.get(path);
+    }
+
+    auto *children = new Util::ArrayList<Util::String>();
+    directoryIndex.put(path, children);
+
+    if (!path.isEmpty()) {
+        auto separator = findLastSeparator(path);
+        if (separator < path.length()) {
+            addDirectory(path.substring(0, separator)).add(path.substring(separator + 1));
+        } else {
+            addDirectory("").add(path);
+        }
+    }
+
+    return *children;
+}
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 #include "filesystem/VirtualDriver.h"
 #include "lib/util/io/file/tar/Archive.h"
 #include "lib/util/collection/Array.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/HashMap.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 
@@ -35,6 +37,8 @@ class ArchiveDriver : public VirtualDriver {
 public:
     /**
      * Constructor.
+     * Tar archives are immutable, so all paths are indexed once at mount time,
+     * making lookups independent of the archive's size.
      *
      * @param archive The tar archive to use.
      */
@@ -53,7 +57,7 @@ public:
     /**
      * Destructor.
      */
-    ~ArchiveDriver() override = default;
+    ~ArchiveDriver() override;
 
     /**
      * Overriding virtual function from VirtualDriver.
@@ -72,8 +76,15 @@ public:
 
 private:
 
+    /**
+     * Get the child list of the given directory, creating it (and all of its parents) if it is not yet indexed.
+     */
+    Util::ArrayList<Util::String>& addDirectory(const Util::String &path);
+
     Util::Io::Tar::Archive &archive;
-    Util::Array<Util::Io::Tar::Archive::Header> fileHeaders{};
+    Util::Array<Util::Io::Tar::Archive::Header*> fileHeaders;
+    Util::HashMap<Util::String, Util::Io::Tar::Archive::Header*> fileIndex;
+    Util::HashMap<Util::String, Util::ArrayList<Util::String>*> directoryIndex;
 
 };
 
@@ -2,7 +2,7 @@
 
 namespace Filesystem::Tar {
 
-ArchiveFileNode::ArchiveFileNode(Util::Io::Tar::Archive &archive, Util::Io::Tar::Archive::Header fileHeader) {
+ArchiveFileNode::ArchiveFileNode(const Util::Io::Tar::Archive::Header &fileHeader) {
     auto path = Util::String(fileHeader.filename);
     if(!path.isEmpty()) {
         Util::Array<Util::String> tokens = path.split("/");
@@ -10,7 +10,7 @@ ArchiveFileNode::ArchiveFileNode(Util::Io::Tar::Archive &archive, Util::Io::Tar:
     }
 
     length = Util::Io::Tar::Archive::calculateFileSize(fileHeader);
-    dataAddress = Util::Address<uint32_t>(archive.getFile(path));
+    dataAddress = Util::Address<uint32_t>(Util::Io::Tar::Archive::getFileData(fileHeader));
 }
 
 Util::String ArchiveFileNode::getName() {
@@ -17,8 +17,10 @@ class ArchiveFileNode : public ArchiveNode {
 public:
     /**
      * File Constructor.
+     *
+     * @param fileHeader The file's header, residing inside the archive
      */
-    ArchiveFileNode(Util::Io::Tar::Archive &archive, Util::Io::Tar::Archive::Header fileHeader);
+    explicit ArchiveFileNode(const Util::Io::Tar::Archive::Header &fileHeader);
 
     /**
      * Copy Constructor.
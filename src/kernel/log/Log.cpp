@@ -26,10 +26,10 @@
 #include "lib/interface.h"
 #include "device/port/serial/Serial.h"
 #include "device/port/serial/SimpleSerialPort.h"
+#include "lib/util/async/Atomic.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/collection/Array.h"
-#include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/HashMap.h"
 #include "lib/util/collection/Iterator.h"
 #include "lib/util/io/stream/OutputStream.h"
@@ -41,7 +41,14 @@ namespace Kernel {
 Log::Level Log::level = Log::INFO;
 Util::Async::Spinlock Log::lock{};
 Util::HashMap<Util::Io::OutputStream*, Util::Io::PrintStream*> Log::streamMap{};
-Util::ArrayList<Util::String> Log::buffer{};
+Log::Message Log::buffer[BUFFER_CAPACITY]{};
+uint32_t Log::head = 0;
+uint32_t Log::tail = 0;
+uint32_t Log::dropped = 0;
+uint32_t Log::droppedTotal = 0;
+bool Log::asynchronous = false;
+Log::SubsystemLevel Log::subsystemLevels[MAX_SUBSYSTEM_COUNT]{};
+uint32_t Log::subsystemCount = 0;
 Device::SimpleSerialPort *Log::serial = nullptr;
 bool Log::serialChecked = false;
 bool Log::earlySerialLoggingEnabled = false;
@@ -50,14 +57,71 @@ void Log::setLevel(Level level) {
     Log::level = level;
 }
 
+void Log::setSubsystemLevel(const Util::String &subsystem, Level level) {
+    if (subsystem.length() >= MAX_SUBSYSTEM_PATH_LENGTH) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Logger: Subsystem path is too long!");
+    }
+
+    for (uint32_t i = 0; i < subsystemCount; i++) {
+        if (subsystem == subsystemLevels[i].path) {
+            subsystemLevels[i].level = level;
+            return;
+        }
+    }
+
+    if (subsystemCount >= MAX_SUBSYSTEM_COUNT) {
+        Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "Logger: Too many subsystem log levels!");
+    }
+
+    auto &entry = subsystemLevels[subsystemCount];
+    const auto *path = static_cast<const char*>(subsystem);
+    for (uint32_t i = 0; i < subsystem.length(); i++) {
+        entry.path[i] = path[i];
+    }
+
+    entry.path[subsystem.length()] = '\0';
+    entry.length = subsystem.length();
+    entry.level = level;
+    subsystemCount++;
+}
+
+void Log::setSubsystemLevels(const Util::String &levels) {
+    for (const auto &entry : levels.split(",")) {
+        const auto parts = entry.split(":");
+        if (parts.length() != 2) {
+            Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Logger: Invalid subsystem log level!");
+        }
+
+        setSubsystemLevel(parts[0], parseLevel(parts[1]));
+    }
+}
+
 void Log::addOutputStream(Util::Io::OutputStream &stream, bool append) {
+    // Write pending messages first, so that they are not replayed twice to the new stream
+    flush();
+
     lock.acquire();
     auto *printStream = new Util::Io::PrintStream(stream);
 
     if (append) {
-        for (const auto &message: buffer) {
-            *printStream << message << Util::Io::PrintStream::endl;
+        // Replay all already flushed messages, which have not been overwritten by newer ones yet
+        for (uint32_t i = tail > BUFFER_CAPACITY ? tail - BUFFER_CAPACITY : 0; i < tail; i++) {
+            const auto &slot = buffer[i % BUFFER_CAPACITY];
+            const auto *sequence = static_cast<const volatile uint32_t*>(&slot.sequence);
+            if (*sequence != i + 1) {
+                continue;
+            }
+
+            auto message = Util::String(slot.text);
+            asm volatile ("" : : : "memory");
+
+            // A producer may have reused the slot while we were copying the message
+            if (*sequence == i + 1) {
+                *printStream << message << Util::Io::PrintStream::endl;
+            }
         }
+
+        printStream->flush();
     }
 
     streamMap.put(&stream, printStream);
@@ -65,6 +129,7 @@ void Log::addOutputStream(Util::Io::OutputStream &stream, bool append) {
 }
 
 void Log::removeOutputStream(Util::Io::OutputStream &stream) {
+    flush();
     lock.acquire();
 
     const auto *printStream = streamMap.get(&stream);
@@ -79,7 +144,7 @@ void Log::disableEarlySerialLogging() {
 }
 
 void Log::log(const Record &record, const char *message...) {
-    if (record.level < level) {
+    if (record.level < getLevel(record.file)) {
         return;
     }
 
@@ -98,30 +163,159 @@ void Log::log(const Record &record, const char *message...) {
 }
 
 void Log::logDefault(const Log::Record &record, const char *message, va_list args) {
-    lock.acquire();
-
+    // Format the message without holding any lock and hand it over to the ring buffer
     uint32_t millis = Util::Time::getSystemTime().toMilliseconds();
     uint32_t seconds = millis / 1000;
     uint32_t fraction = millis % 1000;
 
-    const auto logMessage = Util::String::format("%s[%u.%03u]%s[%s]%s[%s:%s] %s%s",
+    const auto logMessage = Util::String::format("%s[%u.%03u]%s[%s]%s[%s:%s] %s",
              Util::Graphic::Ansi::FOREGROUND_CYAN, seconds, fraction, getColor(record.level), getLevelAsString(record.level),
              Util::Graphic::Ansi::FOREGROUND_MAGENTA, extractFileName(record.file), record.line,
-             Util::Graphic::Ansi::FOREGROUND_DEFAULT, static_cast<const char*>(Util::String::vformat(message, args)));
+             Util::Graphic::Ansi::FOREGROUND_DEFAULT) + Util::String::vformat(message, args);
+
+    enqueue(static_cast<const char*>(logMessage), logMessage.length());
+
+    // Until the flusher thread is running, messages are written out immediately.
+    // Afterwards, the caller only helps out, if the ring buffer fills up faster than the (possibly backed off) flusher drains it.
+    const auto pending = Util::Async::Atomic<uint32_t>(head).get() - *static_cast<const volatile uint32_t*>(&tail);
+    if (!asynchronous || pending >= FLUSH_THRESHOLD) {
+        flush();
+    }
+}
+
+bool Log::enqueue(const char *text, uint32_t length) {
+    auto headAtomic = Util::Async::Atomic<uint32_t>(head);
+    const auto *currentTail = static_cast<const volatile uint32_t*>(&tail);
+
+    uint32_t index;
+    do {
+        index = headAtomic.get();
+        if (index - *currentTail >= BUFFER_CAPACITY) {
+            // The sinks are falling behind -> Drop the message instead of blocking the caller
+            Util::Async::Atomic<uint32_t>(dropped).inc();
+            Util::Async::Atomic<uint32_t>(droppedTotal).inc();
+            return false;
+        }
+    } while (!headAtomic.compareAndSet(index, index + 1));
+
+    auto &slot = buffer[index % BUFFER_CAPACITY];
+    auto *sequence = static_cast<volatile uint32_t*>(&slot.sequence);
+
+    // Invalidate the slot, so that readers replaying old messages do not see a partially written one
+    *sequence = 0;
+    asm volatile ("" : : : "memory");
 
-    buffer.add(logMessage);
+    if (length >= MESSAGE_SIZE) {
+        length = MESSAGE_SIZE - 1;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        slot.text[i] = text[i];
+    }
+
+    slot.text[length] = '\0';
+    slot.length = length;
+
+    // Publishing the sequence number last marks the message as complete
+    asm volatile ("" : : : "memory");
+    *sequence = index + 1;
+
+    return true;
+}
+
+bool Log::flush() {
+    // Never wait for another flusher (e.g. when called from an interrupt, that interrupted the flusher thread)
+    if (!lock.tryAcquire()) {
+        return false;
+    }
 
+    auto *currentTail = static_cast<volatile uint32_t*>(&tail);
+    auto written = false;
+
+    while (true) {
+        const auto index = *currentTail;
+        const auto &slot = buffer[index % BUFFER_CAPACITY];
+        if (*static_cast<const volatile uint32_t*>(&slot.sequence) != index + 1) {
+            break;
+        }
+
+        asm volatile ("" : : : "memory");
+        writeMessage(slot.text);
+        asm volatile ("" : : : "memory");
+
+        *currentTail = index + 1;
+        written = true;
+    }
+
+    const auto droppedCount = Util::Async::Atomic<uint32_t>(dropped).getAndSet(0);
+    if (droppedCount > 0) {
+        const auto dropMessage = Util::String::format("%s[Log] %u messages dropped (sinks are too slow)%s",
+                 Util::Graphic::Ansi::FOREGROUND_BRIGHT_YELLOW, droppedCount, Util::Graphic::Ansi::FOREGROUND_DEFAULT);
+        writeMessage(static_cast<const char*>(dropMessage));
+        written = true;
+    }
+
+    if (written) {
+        for (auto *printStream : streamMap.values()) {
+            printStream->flush();
+        }
+    }
+
+    lock.release();
+    return written;
+}
+
+void Log::enableAsynchronousFlushing() {
+    asynchronous = true;
+}
+
+uint32_t Log::getDroppedMessageCount() {
+    return droppedTotal;
+}
+
+void Log::writeMessage(const char *text) {
     if (earlySerialLoggingEnabled) {
-        writeStringEarly(static_cast<const char*>(logMessage));
+        writeStringEarly(text);
         writeStringEarly("\n");
     }
 
-    for (auto *stream : streamMap.keys()) {
-        auto &printStream = *streamMap.get(stream);
-        printStream << logMessage << Util::Io::PrintStream::endl;
+    for (auto *printStream : streamMap.values()) {
+        *printStream << text << Util::Io::PrintStream::endl;
     }
+}
 
-    lock.release();
+Log::Level Log::getLevel(const char *file) {
+    auto result = level;
+    uint32_t matchLength = 0;
+
+    for (uint32_t i = 0; i < subsystemCount; i++) {
+        const auto &entry = subsystemLevels[i];
+        if (entry.length > matchLength && isInSubsystem(file, entry.path)) {
+            result = entry.level;
+            matchLength = entry.length;
+        }
+    }
+
+    return result;
+}
+
+bool Log::isInSubsystem(const char *file, const char *subsystem) {
+    for (const char *current = file; *current != '\0'; current++) {
+        if (current != file && *(current - 1) != '/') {
+            continue;
+        }
+
+        uint32_t i = 0;
+        while (subsystem[i] != '\0' && current[i] == subsystem[i]) {
+            i++;
+        }
+
+        if (subsystem[i] == '\0' && current[i] == '/') {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 void Log::logEarlyWithHeap(const Log::Record &record, const char *message, va_list args) {
@@ -228,20 +422,24 @@ const char* Log::getColor(const Level &level) {
 }
 
 void Log::setLevel(const Util::String &level) {
+    setLevel(parseLevel(level));
+}
+
+Log::Level Log::parseLevel(const Util::String &level) {
     const auto logLevel = level.toUpperCase();
     if (logLevel == LEVEL_TRACE) {
-        setLevel(Level::TRACE);
+        return TRACE;
     } else if (logLevel == LEVEL_DEBUG) {
-        setLevel(Level::DEBUG);
+        return DEBUG;
     } else if (logLevel == LEVEL_INFO) {
-        setLevel(Level::INFO);
+        return INFO;
     } else if (logLevel == LEVEL_WARN) {
-        setLevel(Level::WARN);
+        return WARN;
     } else if (logLevel == LEVEL_ERROR) {
-        setLevel(Level::ERROR);
-    } else {
-        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Logger: Invalid log level!");
+        return ERROR;
     }
+
+    Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Logger: Invalid log level!");
 }
 
 const Device::SimpleSerialPort &Log::getEarlyLogSerialPort() {
@@ -18,6 +18,8 @@
 #ifndef LOG_H
 #define LOG_H
 
+#include <cstdint>
+
 #include "lib/util/base/String.h"
 
 namespace Device {
@@ -32,7 +34,6 @@ class OutputStream;
 class PrintStream;
 }  // namespace Io
 template <typename K, typename V> class HashMap;
-template <typename T> class ArrayList;
 }  // namespace Util
 
 #define LOG_XSTRINGIFY(a) LOG_STRINGIFY(a)
@@ -90,6 +91,17 @@ public:
 
     static void setLevel(const Util::String &level);
 
+    /**
+     * Override the log level for all source files located in a subsystem directory (e.g. "device/usb").
+     * The most specific matching subsystem wins, files outside any configured subsystem use the global level.
+     */
+    static void setSubsystemLevel(const Util::String &subsystem, Level level);
+
+    /**
+     * Parse a comma separated list of subsystem levels (e.g. "device/usb:wrn,kernel/network:dbg").
+     */
+    static void setSubsystemLevels(const Util::String &levels);
+
     static void addOutputStream(Util::Io::OutputStream &stream, bool append = true);
 
     static void removeOutputStream(Util::Io::OutputStream &stream);
@@ -98,10 +110,43 @@ public:
 
     static void log(const Record &record, const char *message...);
 
+    /**
+     * Write all pending messages from the ring buffer to the registered output streams.
+     * Returns immediately if another thread is already flushing.
+     *
+     * @return true, if any message has been written
+     */
+    static bool flush();
+
+    /**
+     * Stop flushing messages synchronously inside log() and leave it to a dedicated flusher thread (see LogFlusher).
+     */
+    static void enableAsynchronousFlushing();
+
+    [[nodiscard]] static uint32_t getDroppedMessageCount();
+
     static const Device::SimpleSerialPort& getEarlyLogSerialPort();
 
 private:
 
+    static const constexpr uint32_t BUFFER_CAPACITY = 256;
+    static const constexpr uint32_t FLUSH_THRESHOLD = BUFFER_CAPACITY * 3 / 4;
+    static const constexpr uint32_t MESSAGE_SIZE = 256;
+    static const constexpr uint32_t MAX_SUBSYSTEM_COUNT = 16;
+    static const constexpr uint32_t MAX_SUBSYSTEM_PATH_LENGTH = 32;
+
+    struct Message {
+        uint32_t sequence;
+        uint32_t length;
+        char text[MESSAGE_SIZE];
+    };
+
+    struct SubsystemLevel {
+        char path[MAX_SUBSYSTEM_PATH_LENGTH];
+        uint32_t length;
+        Level level;
+    };
+
     static void logDefault(const Record &record, const char *message, va_list args);
 
     static void logEarlyWithHeap(const Record &record, const char *message, va_list args);
@@ -110,6 +155,16 @@ private:
 
     static void writeStringEarly(const char *string);
 
+    static bool enqueue(const char *text, uint32_t length);
+
+    static void writeMessage(const char *text);
+
+    static Level getLevel(const char *file);
+
+    static bool isInSubsystem(const char *file, const char *subsystem);
+
+    static Level parseLevel(const Util::String &level);
+
     static const char* extractFileName(const char *path);
 
     static const char* getLevelAsString(const Level &level);
@@ -120,7 +175,16 @@ private:
 
     static Util::Async::Spinlock lock;
     static Util::HashMap<Util::Io::OutputStream*, Util::Io::PrintStream*> streamMap;
-    static Util::ArrayList<Util::String> buffer;
+
+    static Message buffer[BUFFER_CAPACITY];
+    static uint32_t head;
+    static uint32_t tail;
+    static uint32_t dropped;
+    static uint32_t droppedTotal;
+    static bool asynchronous;
+
+    static SubsystemLevel subsystemLevels[MAX_SUBSYSTEM_COUNT];
+    static uint32_t subsystemCount;
 
     static Device::SimpleSerialPort *serial;
     static bool serialChecked;
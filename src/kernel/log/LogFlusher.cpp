@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "LogFlusher.h"
+
+#include "kernel/log/Log.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Kernel {
+
+void LogFlusher::run() {
+    Log::enableAsynchronousFlushing();
+
+    // Back off while there is nothing to write, so that an idle system is not woken up periodically by the flusher
+    auto interval = MIN_FLUSH_INTERVAL;
+    while (true) {
+        if (Log::flush()) {
+            interval = MIN_FLUSH_INTERVAL;
+        } else if (interval < MAX_FLUSH_INTERVAL) {
+            interval = interval * 2 > MAX_FLUSH_INTERVAL ? MAX_FLUSH_INTERVAL : interval * 2;
+        }
+
+        Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(interval));
+    }
+}
+
+}
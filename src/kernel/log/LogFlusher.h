@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LOGFLUSHER_H
+#define HHUOS_LOGFLUSHER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Runnable.h"
+
+namespace Kernel {
+
+/**
+ * Drains the kernel log ring buffer to the registered output streams in batches,
+ * so that threads calling LOG_* never have to wait for slow sinks (e.g. serial ports or the terminal).
+ * The flusher polls the ring buffer, since waking it up from LOG_* is not possible in interrupt context.
+ * While the buffer stays empty, the polling interval is doubled up to MAX_FLUSH_INTERVAL.
+ */
+class LogFlusher : public Util::Async::Runnable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    LogFlusher() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    LogFlusher(const LogFlusher &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    LogFlusher &operator=(const LogFlusher &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~LogFlusher() override = default;
+
+    void run() override;
+
+private:
+
+    static const constexpr uint32_t MIN_FLUSH_INTERVAL = 10;
+    // Same as the longest idle period of the scheduler, so that an idle flusher does not shorten it
+    static const constexpr uint32_t MAX_FLUSH_INTERVAL = 1000;
+};
+
+}
+
+#endif
@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Trace.h"
+
+#include "kernel/process/Scheduler.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/InterruptService.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/Service.h"
+#include "kernel/service/TimeService.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Kernel {
+
+bool Trace::enabled = false;
+Trace::RingBuffer Trace::buffers[MAX_CPU_COUNT]{};
+TimeService *Trace::timeService = nullptr;
+InterruptService *Trace::interruptService = nullptr;
+Scheduler *Trace::scheduler = nullptr;
+
+const Trace::EventDescriptor Trace::descriptors[EVENT_COUNT] = {
+        { "thread_switch", "scheduler", INSTANT, { "from", "to", nullptr } },
+        { "page_fault", "memory", BEGIN, { "address", "error", nullptr } },
+        { "page_fault", "memory", END, { nullptr, nullptr, nullptr } },
+        { "system_call", "interrupt", BEGIN, { "code", "parameters", nullptr } },
+        { "system_call", "interrupt", END, { "result", nullptr, nullptr } },
+        { "interrupt", "interrupt", INSTANT, { "vector", nullptr, nullptr } },
+        { "packet_received", "network", INSTANT, { "length", nullptr, nullptr } }
+};
+
+void Trace::enable() {
+    enabled = false;
+
+    timeService = &Service::getService<TimeService>();
+    interruptService = &Service::getService<InterruptService>();
+    scheduler = &Service::getService<ProcessService>().getScheduler();
+
+    for (auto &buffer : buffers) {
+        if (buffer.records == nullptr) {
+            buffer.records = new Record[RECORDS_PER_CPU];
+        }
+
+        // Clearing invalidates records of previous sessions and maps the buffer, so that tracepoints never cause page faults
+        Util::Address<uint32_t>(buffer.records).setRange(0, sizeof(Record) * RECORDS_PER_CPU);
+        buffer.next = 0;
+    }
+
+    enabled = true;
+}
+
+void Trace::disable() {
+    enabled = false;
+}
+
+void Trace::record(Event event, uint32_t argument0, uint32_t argument1, uint32_t argument2) {
+    auto cpuId = interruptService->getCpuId();
+    if (cpuId >= MAX_CPU_COUNT) {
+        return;
+    }
+
+    // The increment is atomic, since a tracepoint may be interrupted by another tracepoint on the same CPU
+    auto &buffer = buffers[cpuId];
+    auto index = Util::Async::Atomic<uint32_t>(buffer.next).fetchAndInc();
+    auto &record = buffer.records[index % RECORDS_PER_CPU];
+
+    // Invalidate the slot while writing, so that readers do not see a partially overwritten record
+    record.sequence = 0;
+    asm volatile ("" : : : "memory");
+
+    record.timestamp = timeService->getSystemTime().toNanoseconds();
+    record.event = event;
+    record.cpuId = cpuId;
+    // Currently, only the bootstrap processor runs threads
+    record.threadId = cpuId == 0 && scheduler->isInitialized() ? scheduler->getCurrentThread().getId() : 0;
+    record.arguments[0] = argument0;
+    record.arguments[1] = argument1;
+    record.arguments[2] = argument2;
+
+    asm volatile ("" : : : "memory");
+    record.sequence = index + 1;
+}
+
+uint32_t Trace::getRecordCount() {
+    uint32_t count = 0;
+    for (const auto &buffer : buffers) {
+        count += buffer.next < RECORDS_PER_CPU ? buffer.next : RECORDS_PER_CPU;
+    }
+
+    return count;
+}
+
+uint32_t Trace::getOverwrittenCount() {
+    uint32_t count = 0;
+    for (const auto &buffer : buffers) {
+        count += buffer.next < RECORDS_PER_CPU ? 0 : buffer.next - RECORDS_PER_CPU;
+    }
+
+    return count;
+}
+
+Util::String Trace::dumpText() {
+    auto string = Util::String::format("Records: %u (Overwritten: %u)\n", getRecordCount(), getOverwrittenCount());
+    forEachRecord(appendText, &string);
+
+    return string;
+}
+
+Util::String Trace::dumpChromeJson() {
+    Util::String string = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    forEachRecord(appendChromeJson, &string);
+
+    // Every event is followed by a comma -> Replace the last one
+    if (string[string.length() - 1] == ',') {
+        string = string.substring(0, string.length() - 1);
+    }
+
+    return string + "]}\n";
+}
+
+bool Trace::readRecord(const RingBuffer &buffer, uint32_t index, Record &target) {
+    const auto &slot = buffer.records[index % RECORDS_PER_CPU];
+    const auto *sequence = static_cast<const volatile uint32_t*>(&slot.sequence);
+
+    // The record is valid, if its sequence number has not changed while copying it
+    if (*sequence != index + 1) {
+        return false;
+    }
+
+    asm volatile ("" : : : "memory");
+    target = slot;
+    asm volatile ("" : : : "memory");
+
+    return *sequence == index + 1;
+}
+
+void Trace::forEachRecord(void (*function)(const Record &record, void *argument), void *argument) {
+    uint32_t positions[MAX_CPU_COUNT];
+    uint32_t ends[MAX_CPU_COUNT];
+    for (uint32_t i = 0; i < MAX_CPU_COUNT; i++) {
+        ends[i] = buffers[i].next;
+        positions[i] = ends[i] > RECORDS_PER_CPU ? ends[i] - RECORDS_PER_CPU : 0;
+    }
+
+    // Merge the ring buffers of all CPUs by timestamp (each ring buffer is already ordered)
+    while (true) {
+        Record next{};
+        Record current{};
+        uint32_t nextCpu = MAX_CPU_COUNT;
+
+        for (uint32_t i = 0; i < MAX_CPU_COUNT; i++) {
+            while (positions[i] < ends[i] && !readRecord(buffers[i], positions[i], current)) {
+                positions[i]++; // Skip records, which are being written (or have been overwritten) in the meantime
+            }
+
+            if (positions[i] < ends[i] && (nextCpu == MAX_CPU_COUNT || current.timestamp < next.timestamp)) {
+                next = current;
+                nextCpu = i;
+            }
+        }
+
+        if (nextCpu == MAX_CPU_COUNT) {
+            break;
+        }
+
+        function(next, argument);
+        positions[nextCpu]++;
+    }
+}
+
+void Trace::appendText(const Record &record, void *string) {
+    const auto &descriptor = descriptors[record.event];
+    auto seconds = static_cast<uint32_t>(record.timestamp / 1000000000);
+    auto microseconds = static_cast<uint32_t>((record.timestamp / 1000) % 1000000);
+
+    auto line = Util::String::format("[%u.%06u] CPU %u, Thread %u: %s", seconds, microseconds, record.cpuId, record.threadId, descriptor.name);
+    if (descriptor.phase != INSTANT) {
+        line += descriptor.phase == BEGIN ? " (begin)" : " (end)";
+    }
+
+    for (uint32_t i = 0; i < 3 && descriptor.argumentNames[i] != nullptr; i++) {
+        line += Util::String::format(" %s=0x%08x", descriptor.argumentNames[i], record.arguments[i]);
+    }
+
+    *static_cast<Util::String*>(string) += line + "\n";
+}
+
+void Trace::appendChromeJson(const Record &record, void *string) {
+    const auto &descriptor = descriptors[record.event];
+    auto event = Util::String::format("{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%s,\"pid\":%u,\"tid\":%u",
+                                      descriptor.name, descriptor.category, descriptor.phase, static_cast<const char*>(formatMicroseconds(record.timestamp)), record.cpuId, record.threadId);
+
+    if (descriptor.phase == INSTANT) {
+        event += ",\"s\":\"t\"";
+    }
+
+    if (descriptor.argumentNames[0] != nullptr) {
+        event += ",\"args\":{";
+        for (uint32_t i = 0; i < 3 && descriptor.argumentNames[i] != nullptr; i++) {
+            event += Util::String::format(i == 0 ? "\"%s\":%u" : ",\"%s\":%u", descriptor.argumentNames[i], record.arguments[i]);
+        }
+        event += "}";
+    }
+
+    *static_cast<Util::String*>(string) += event + "},";
+}
+
+Util::String Trace::formatMicroseconds(uint64_t nanoseconds) {
+    // String::format only supports 32-bit values -> Split into seconds, microseconds and the remaining nanoseconds
+    auto seconds = static_cast<uint32_t>(nanoseconds / 1000000000);
+    auto microseconds = static_cast<uint32_t>((nanoseconds / 1000) % 1000000);
+    auto remainder = static_cast<uint32_t>(nanoseconds % 1000);
+
+    // JSON does not allow leading zeros
+    return seconds == 0 ? Util::String::format("%u.%03u", microseconds, remainder) : Util::String::format("%u%06u.%03u", seconds, microseconds, remainder);
+}
+
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TRACE_H
+#define HHUOS_TRACE_H
+
+#include <cstdint>
+
+#include "lib/util/base/String.h"
+
+/**
+ * Static tracepoint. Costs a single branch, while tracing is disabled.
+ * Up to three 32-bit arguments are stored in the record; they are only formatted when the trace is dumped.
+ */
+#define TRACEPOINT(event, arguments...) do { if (Kernel::Trace::isEnabled()) { Kernel::Trace::record(Kernel::Trace::event, ##arguments); } } while (false)
+
+namespace Kernel {
+class Scheduler;
+class InterruptService;
+class TimeService;
+
+/**
+ * Lightweight event tracing for hot paths, which are too frequent for Kernel::Log.
+ * Each tracepoint writes a fixed-size binary record into the ring buffer of the current CPU (the oldest records are overwritten).
+ * Slots are reserved with an atomic increment, so tracepoints work in any context (including nested interrupts) without locking.
+ * A record is marked valid by writing its sequence number last, so that readers can skip records, which are currently being written.
+ * Records are formatted on demand, either as text or in the Chrome trace event format (JSON, readable by Perfetto and chrome://tracing).
+ */
+class Trace {
+
+public:
+
+    enum Event : uint16_t {
+        THREAD_SWITCH,
+        PAGE_FAULT_BEGIN,
+        PAGE_FAULT_END,
+        SYSTEM_CALL_BEGIN,
+        SYSTEM_CALL_END,
+        INTERRUPT,
+        PACKET_RECEIVED,
+        EVENT_COUNT
+    };
+
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    Trace() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    Trace(const Trace &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Trace &operator=(const Trace &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Trace() = default;
+
+    /**
+     * Discard all records and enable the tracepoints. The ring buffers are allocated on the first call.
+     * Requires the time, interrupt and process services to be registered.
+     */
+    static void enable();
+
+    static void disable();
+
+    [[nodiscard]] static bool isEnabled() {
+        return enabled;
+    }
+
+    static void record(Event event, uint32_t argument0 = 0, uint32_t argument1 = 0, uint32_t argument2 = 0);
+
+    [[nodiscard]] static uint32_t getRecordCount();
+
+    [[nodiscard]] static uint32_t getOverwrittenCount();
+
+    /**
+     * Format all valid records as text, one line per record, ordered by their timestamp.
+     */
+    [[nodiscard]] static Util::String dumpText();
+
+    /**
+     * Format all valid records as JSON object in the Chrome trace event format.
+     * Each CPU is shown as a process and each thread as a thread.
+     */
+    [[nodiscard]] static Util::String dumpChromeJson();
+
+    static const constexpr uint32_t RECORDS_PER_CPU = 4096;
+    static const constexpr uint32_t MAX_CPU_COUNT = 8;
+
+private:
+
+    enum Phase : char {
+        INSTANT = 'i',
+        BEGIN = 'B',
+        END = 'E'
+    };
+
+    struct Record {
+        uint64_t timestamp;
+        uint32_t sequence;
+        Event event;
+        uint8_t cpuId;
+        uint8_t reserved;
+        uint32_t threadId;
+        uint32_t arguments[3];
+    };
+
+    struct RingBuffer {
+        Record *records;
+        uint32_t next;
+    };
+
+    struct EventDescriptor {
+        const char *name;
+        const char *category;
+        Phase phase;
+        const char *argumentNames[3];
+    };
+
+    static bool readRecord(const RingBuffer &buffer, uint32_t index, Record &target);
+
+    static void forEachRecord(void (*function)(const Record &record, void *argument), void *argument);
+
+    static void appendText(const Record &record, void *string);
+
+    static void appendChromeJson(const Record &record, void *string);
+
+    static Util::String formatMicroseconds(uint64_t nanoseconds);
+
+    static bool enabled;
+    static RingBuffer buffers[MAX_CPU_COUNT];
+    static TimeService *timeService;
+    static InterruptService *interruptService;
+    static Scheduler *scheduler;
+
+    static const EventDescriptor descriptors[EVENT_COUNT];
+};
+
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TraceNode.h"
+
+#include "kernel/log/Trace.h"
+
+namespace Kernel {
+
+TraceNode::TraceNode(const Util::String &name, Type type) : StringNode(name), type(type) {}
+
+Util::String TraceNode::getString() {
+    switch (type) {
+        case TEXT:
+            return Trace::dumpText();
+        case CHROME_JSON:
+            return Trace::dumpChromeJson();
+        default:
+            return Util::String::format("State: %s\nRecords: %u\nOverwritten: %u\n", Trace::isEnabled() ? "running" : "stopped",
+                                        Trace::getRecordCount(), Trace::getOverwrittenCount());
+    }
+}
+
+uint64_t TraceNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    if (type != CONTROL) {
+        return 0;
+    }
+
+    auto command = Util::String(sourceBuffer, numBytes).strip();
+    if (command == "start") {
+        Trace::enable();
+    } else if (command == "stop") {
+        Trace::disable();
+    } else {
+        return 0;
+    }
+
+    return numBytes;
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TRACENODE_H
+#define HHUOS_TRACENODE_H
+
+#include <cstdint>
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Exposes the kernel event trace (see Kernel::Trace) in /system/trace.
+ * The 'control' node shows the tracing state and accepts the commands 'start' and 'stop'.
+ * The 'events' node formats all records as text, 'chrome.json' in the Chrome trace event format (e.g. for Perfetto).
+ * Since recording continues while a node is read, tracing should be stopped before reading a dump.
+ */
+class TraceNode : public Filesystem::Memory::StringNode {
+
+public:
+
+    enum Type {
+        CONTROL,
+        TEXT,
+        CHROME_JSON
+    };
+
+    /**
+     * Constructor.
+     */
+    TraceNode(const Util::String &name, Type type);
+
+    /**
+     * Copy Constructor.
+     */
+    TraceNode(const TraceNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TraceNode& operator=(const TraceNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TraceNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+
+    /**
+     * Overriding function from MemoryNode.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+
+private:
+
+    Type type;
+};
+
+}
+
+#endif
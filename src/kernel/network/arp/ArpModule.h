@@ -101,7 +101,7 @@ private:
 
     void handleReply(const Util::Network::MacAddress &sourceHardwareAddress, const Util::Network::Ip4::Ip4Address &sourceAddress, const Util::Network::MacAddress &targetHardwareAddress, const Util::Network::Ip4::Ip4Address &targetProtocolAddress);
 
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReentrantSpinlock lock{"Network::Arp"};
     Util::ArrayList<ArpEntry> arpCache;
 
     static const constexpr uint32_t REQUEST_WAIT_TIME = 100;
@@ -193,24 +193,30 @@ Ip4RoutingModule &Ip4Module::getRoutingModule() {
 }
 
 uint16_t Ip4Module::calculateChecksum(const uint8_t *buffer, uint32_t offset, uint32_t length) {
-    uint32_t checksum = 0;
-    for (uint8_t i = 0; i < length; i += 2) {
-        // Ignore checksum field
-        if (i == offset) {
-            continue;
-        }
+    // Ignore checksum field
+    auto checksum = addToChecksum(buffer, offset, 0);
+    checksum = addToChecksum(buffer + offset + sizeof(uint16_t), length - offset - sizeof(uint16_t), checksum);
+
+    // Complement result
+    return ~checksum;
+}
 
-        checksum += (buffer[i] << 8) | buffer[i + 1];
+uint16_t Ip4Module::addToChecksum(const uint8_t *buffer, uint32_t length, uint16_t sum) {
+    uint32_t checksum = sum;
+    for (; length >= 2; length -= 2, buffer += 2) {
+        checksum += (buffer[0] << 8) | buffer[1];
     }
 
-    // Add overflow bits
-    checksum += reinterpret_cast<uint16_t*>(&checksum)[1];
+    if (length > 0) {
+        checksum += buffer[0] << 8;
+    }
 
-    // Cut off high bytes
-    checksum = static_cast<uint16_t>(checksum);
+    // Add overflow bits
+    while (checksum >> 16 > 0) {
+        checksum = (checksum >> 16) + (checksum & 0xffff);
+    }
 
-    // Complement result
-    return ~checksum;
+    return checksum;
 }
 
 }
\ No newline at end of file
@@ -92,11 +92,18 @@ public:
 
     static uint16_t calculateChecksum(const uint8_t *buffer, uint32_t offset, uint32_t length);
 
+    /**
+     * Add the 16-bit words of a buffer in network byte order to a one's complement sum (RFC 1071).
+     * A trailing odd byte is padded with zero. The result is not complemented,
+     * so that a checksum can be calculated over several buffers.
+     */
+    static uint16_t addToChecksum(const uint8_t *buffer, uint32_t length, uint16_t sum);
+
 private:
 
     Ip4RoutingModule routingModule;
     Util::ArrayList<Ip4Interface> interfaces;
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReentrantSpinlock lock{"Network::Ip4"};
 };
 
 }
@@ -77,7 +77,7 @@ private:
 
     Util::Network::Ip4::Ip4Route defaultRoute;
     Util::ArrayList<Util::Network::Ip4::Ip4Route> routes;
-    Util::Async::ReentrantSpinlock lock;
+    Util::Async::ReentrantSpinlock lock{"Network::Ip4Routing"};
 };
 
 }
@@ -129,28 +129,11 @@ void UdpModule::writePacket(const Util::Network::Ip4::Ip4PortAddress &sourceAddr
 }
 
 uint16_t UdpModule::calculateChecksum(const uint8_t *pseudoHeader, const uint8_t *datagram, uint16_t datagramLength) {
-    uint32_t checksum = 0;
-    for (uint16_t i = 0; i < Ip4PseudoHeader::HEADER_SIZE; i += 2) {
-        checksum += (pseudoHeader[i] << 8) | pseudoHeader[i + 1];
-    }
-
-    for (uint16_t i = 0; i < datagramLength; i += 2) {
-        // Ignore checksum field
-        if (i == 6) {
-            continue;
-        }
+    auto checksum = Ip4::Ip4Module::addToChecksum(pseudoHeader, Ip4PseudoHeader::HEADER_SIZE, 0);
 
-        if (i == datagramLength - 1) {
-            checksum += datagram[i] << 8;
-        } else {
-            checksum += (datagram[i] << 8) | datagram[i + 1];
-        }
-    }
-
-    // Add overflow bits
-    while (checksum >> 16 > 0) {
-        checksum = (checksum >> 16) + (checksum & 0xffff);
-    }
+    // Ignore checksum field (last two bytes of the header)
+    checksum = Ip4::Ip4Module::addToChecksum(datagram, Util::Network::Udp::UdpHeader::HEADER_SIZE - sizeof(uint16_t), checksum);
+    checksum = Ip4::Ip4Module::addToChecksum(datagram + Util::Network::Udp::UdpHeader::HEADER_SIZE, datagramLength - Util::Network::Udp::UdpHeader::HEADER_SIZE, checksum);
 
     // Complement result
     return ~checksum;
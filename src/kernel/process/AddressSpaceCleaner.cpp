@@ -24,6 +24,7 @@
 #include "kernel/memory/MemoryLayout.h"
 #include "lib/util/base/Constants.h"
 #include "kernel/process/Scheduler.h"
+#include "kernel/process/Profiler.h"
 
 namespace Kernel {
 
@@ -34,6 +35,13 @@ void AddressSpaceCleaner::run() {
         processService.getScheduler().yield();
     }
 
+    // Symbolize profiler samples of killed processes, while their symbol table is still mapped (exited processes have already done this)
+    if (!currentProcess.isKernelProcess()) {
+        Profiler::resolveSymbols(currentProcess);
+    }
+
+    // The time page is shared by all processes, so its physical page must not be freed
+    Service::getService<MemoryService>().getCurrentAddressSpace().unmap(reinterpret_cast<void*>(Util::TIME_PAGE_ADDRESS));
     Service::getService<MemoryService>().unmap(reinterpret_cast<void*>(Kernel::MemoryLayout::KERNEL_END), ((Kernel::MemoryLayout::MEMORY_END - Kernel::MemoryLayout::KERNEL_END) + 1) / Util::PAGESIZE, 0);
     processService.cleanup(&currentProcess);
 }
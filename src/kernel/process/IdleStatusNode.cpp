@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "IdleStatusNode.h"
+
+#include "device/cpu/SymmetricMultiprocessing.h"
+#include "kernel/process/Scheduler.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/Service.h"
+#include "kernel/service/TimeService.h"
+
+namespace Kernel {
+
+IdleStatusNode::IdleStatusNode(const Util::String &name) : StringNode(name) {}
+
+Util::String IdleStatusNode::getString() {
+    auto uptime = static_cast<uint32_t>(Service::getService<TimeService>().getSystemTime().toMilliseconds());
+    auto idleTime = static_cast<uint32_t>(Service::getService<ProcessService>().getScheduler().getIdleTime().toMilliseconds());
+    auto permille = uptime == 0 ? 0 : static_cast<uint32_t>((static_cast<uint64_t>(idleTime) * 1000) / uptime);
+
+    auto string = Util::String::format("CPU 0: %u.%u%c idle (Idle: %u ms, Uptime: %u ms)\n", permille / 10, permille % 10, '%', idleTime, uptime);
+
+    // Application processors are started, but not used by the scheduler yet -> They are halted all the time
+    for (uint32_t i = 0; i < 255; i++) {
+        if (Device::runningApplicationProcessors[i]) {
+            string += Util::String::format("CPU %u: 100.0%c idle (Not scheduled)\n", i + 1, '%');
+        }
+    }
+
+    return string;
+}
+
+}
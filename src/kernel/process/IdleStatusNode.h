@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IDLESTATUSNODE_H
+#define HHUOS_IDLESTATUSNODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Shows the idle residency of each CPU, i.e. the share of uptime spent halted, because no thread was ready to run.
+ */
+class IdleStatusNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit IdleStatusNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    IdleStatusNode(const IdleStatusNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IdleStatusNode& operator=(const IdleStatusNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~IdleStatusNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+};
+
+}
+
+#endif
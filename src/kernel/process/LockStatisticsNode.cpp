@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "LockStatisticsNode.h"
+
+#include "lib/util/async/LockStatistics.h"
+
+namespace Kernel {
+
+LockStatisticsNode::LockStatisticsNode(const Util::String &name) : StringNode(name) {}
+
+Util::String LockStatisticsNode::getString() {
+    if (!Util::Async::LockStatistics::isEnabled()) {
+        return "Lock statistics are disabled (boot with 'lock_statistics=true' to enable them)\n";
+    }
+
+    Util::String string = "Name | Acquisitions | Contended | Spins | Hold time (kCycles) | Max hold time (Cycles)\n";
+    Util::Async::LockStatistics::forEach(appendStatistics, &string);
+
+    return string;
+}
+
+void LockStatisticsNode::appendStatistics(const Util::Async::LockStatistics &statistics, void *string) {
+    auto spins = statistics.getSpins();
+    auto holdCycles = statistics.getHoldCycles() / 1000;
+    auto maxHoldCycles = statistics.getMaxHoldCycles();
+
+    *static_cast<Util::String*>(string) += Util::String::format("%s | %u | %u | %u | %u | %u\n", statistics.getName(),
+            statistics.getAcquisitions(), statistics.getContentions(),
+            static_cast<uint32_t>(spins > UINT32_MAX ? UINT32_MAX : spins),
+            static_cast<uint32_t>(holdCycles > UINT32_MAX ? UINT32_MAX : holdCycles),
+            static_cast<uint32_t>(maxHoldCycles > UINT32_MAX ? UINT32_MAX : maxHoldCycles));
+}
+
+}
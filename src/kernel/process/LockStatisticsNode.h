@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LOCKSTATISTICSNODE_H
+#define HHUOS_LOCKSTATISTICSNODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Util {
+namespace Async {
+class LockStatistics;
+}  // namespace Async
+}  // namespace Util
+
+namespace Kernel {
+
+/**
+ * Lists the contention statistics of all named locks (see Util::Async::LockStatistics).
+ * Statistics are only recorded, if the kernel has been started with 'lock_statistics=true'.
+ */
+class LockStatisticsNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit LockStatisticsNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    LockStatisticsNode(const LockStatisticsNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    LockStatisticsNode& operator=(const LockStatisticsNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~LockStatisticsNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+
+private:
+
+    static void appendStatistics(const Util::Async::LockStatistics &statistics, void *string);
+};
+
+}
+
+#endif
@@ -129,6 +129,19 @@ void Process::addThread(Thread &thread) {
 
 void Process::removeThread(Thread &thread) {
     threads.remove(&thread);
+
+    // The main thread's stack is not allocated on the heap and the process terminates with it anyway.
+    // This is called with the scheduler's ready queue locked, so the pool lock must not be waited for (the holder could never be scheduled).
+    if (!thread.isKernelThread() && &thread != mainThread && userStackPoolLock.tryAcquire()) {
+        userStackPool.add(thread.getUserStack());
+        userStackPoolLock.release();
+    }
+}
+
+uint32_t* Process::reuseUserStack() {
+    userStackPoolLock.acquire();
+    auto *stack = userStackPool.size() > 0 ? userStackPool.removeIndex(userStackPool.size() - 1) : nullptr;
+    return userStackPoolLock.releaseAndReturn(stack);
 }
 
 void Process::killAllThreadsButCurrent() {
@@ -26,6 +26,7 @@
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/base/String.h"
 #include "kernel/process/Thread.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Util {
 namespace Async {
@@ -91,8 +92,19 @@ public:
 
     void addThread(Thread &thread);
 
+    /**
+     * Remove a terminated thread from this process.
+     * Its user stack is kept and handed out to the next thread created in this process (see reuseUserStack()).
+     */
     void removeThread(Thread &thread);
 
+    /**
+     * Take the user stack of a previously terminated thread.
+     *
+     * @return The stack, or nullptr, if no stack is available
+     */
+    [[nodiscard]] uint32_t* reuseUserStack();
+
     void killAllThreadsButCurrent();
 
 private:
@@ -105,6 +117,8 @@ private:
     FileDescriptorManager fileDescriptorManager;
     Util::Io::File workingDirectory;
     Util::ArrayList<Thread*> threads;
+    Util::ArrayList<uint32_t*> userStackPool;
+    Util::Async::Spinlock userStackPoolLock;
     Thread *mainThread = nullptr;
 
     bool finished = false;
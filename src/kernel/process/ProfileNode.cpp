@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ProfileNode.h"
+
+#include "kernel/process/Profiler.h"
+
+namespace Kernel {
+
+ProfileNode::ProfileNode(const Util::String &name, Type type) : StringNode(name), type(type) {}
+
+Util::String ProfileNode::getString() {
+    switch (type) {
+        case FLAT:
+            return Profiler::getFlatReport();
+        case CALL_GRAPH:
+            return Profiler::getCallGraphReport();
+        default:
+            return Util::String::format("State: %s\nSamples: %u\nOverwritten: %u\n", Profiler::isRunning() ? "running" : "stopped",
+                                        Profiler::getSampleCount(), Profiler::getOverwrittenCount());
+    }
+}
+
+uint64_t ProfileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    if (type != CONTROL) {
+        return 0;
+    }
+
+    auto command = Util::String(sourceBuffer, numBytes).strip();
+    if (command == "start") {
+        Profiler::start();
+    } else if (command == "stop") {
+        Profiler::stop();
+    } else {
+        return 0;
+    }
+
+    return numBytes;
+}
+
+}
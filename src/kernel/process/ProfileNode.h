@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PROFILENODE_H
+#define HHUOS_PROFILENODE_H
+
+#include <cstdint>
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Exposes the sampling profiler (see Kernel::Profiler) in /system/profile.
+ * The 'control' node shows the profiler's state and accepts the commands 'start' and 'stop'.
+ * The 'flat' and 'callgraph' nodes generate the respective report on each read.
+ * Since sampling continues while a report is read, the profiler should be stopped before reading a report.
+ */
+class ProfileNode : public Filesystem::Memory::StringNode {
+
+public:
+
+    enum Type {
+        CONTROL,
+        FLAT,
+        CALL_GRAPH
+    };
+
+    /**
+     * Constructor.
+     */
+    ProfileNode(const Util::String &name, Type type);
+
+    /**
+     * Copy Constructor.
+     */
+    ProfileNode(const ProfileNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ProfileNode& operator=(const ProfileNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ProfileNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+
+    /**
+     * Overriding function from MemoryNode.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+
+private:
+
+    Type type;
+};
+
+}
+
+#endif
@@ -0,0 +1,318 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Profiler.h"
+
+#include "kernel/interrupt/InterruptFrame.h"
+#include "kernel/memory/MemoryLayout.h"
+#include "kernel/memory/VirtualAddressSpace.h"
+#include "kernel/process/Process.h"
+#include "kernel/process/Scheduler.h"
+#include "kernel/service/InformationService.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/Service.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/base/Constants.h"
+#include "lib/util/base/System.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/elf/File.h"
+
+namespace Kernel {
+
+bool Profiler::running = false;
+Profiler::RingBuffer Profiler::buffers[MAX_CPU_COUNT]{};
+Util::ArrayList<Profiler::ResolvedSymbol*> Profiler::resolvedSymbols{};
+Util::Async::Spinlock Profiler::symbolLock;
+
+void Profiler::start() {
+    running = false;
+
+    for (auto &buffer : buffers) {
+        if (buffer.samples == nullptr) {
+            buffer.samples = new Sample[SAMPLES_PER_CPU];
+        }
+
+        // Clearing maps the buffer, so that sampling never causes page faults inside the timer interrupt
+        Util::Address<uint32_t>(buffer.samples).setRange(0, sizeof(Sample) * SAMPLES_PER_CPU);
+        buffer.written = 0;
+    }
+
+    symbolLock.acquire();
+    for (uint32_t i = 0; i < resolvedSymbols.size(); i++) {
+        delete resolvedSymbols.get(i);
+    }
+    resolvedSymbols.clear();
+    symbolLock.release();
+
+    running = true;
+}
+
+void Profiler::stop() {
+    running = false;
+}
+
+bool Profiler::isRunning() {
+    return running;
+}
+
+void Profiler::sample(const InterruptFrame &frame, uint8_t cpuId) {
+    if (!running || cpuId >= MAX_CPU_COUNT) {
+        return;
+    }
+
+    auto &buffer = buffers[cpuId];
+    auto &sample = buffer.samples[buffer.written % SAMPLES_PER_CPU];
+    auto &scheduler = Service::getService<ProcessService>().getScheduler();
+
+    // The interrupt handlers (see InterruptDescriptorTable) set up a regular stack frame,
+    // so the frame pointer of the interrupted code is saved directly below the frame pushed by the CPU.
+    auto framePointer = reinterpret_cast<const uint32_t*>(&frame)[-1];
+
+    sample.processId = scheduler.isInitialized() ? scheduler.getCurrentThread().getParent().getId() : 0;
+    sample.addresses[0] = frame.instructionPointer;
+    sample.depth = 1 + captureBacktrace(framePointer, sample.addresses + 1, MAX_DEPTH - 1);
+    buffer.written++;
+}
+
+uint32_t Profiler::captureBacktrace(uint32_t framePointer, uint32_t *addresses, uint32_t maxDepth) {
+    const auto &addressSpace = Service::getService<MemoryService>().getCurrentAddressSpace();
+    uint32_t depth = 0;
+
+    while (depth < maxDepth) {
+        // Only follow frame pointers into mapped memory, since a page fault must not occur inside the timer interrupt
+        if (framePointer < MemoryLayout::KERNEL_START || framePointer % sizeof(uint32_t) != 0 || framePointer > MemoryLayout::MEMORY_END - 2 * sizeof(uint32_t) ||
+            addressSpace.getPhysicalAddress(reinterpret_cast<void*>(framePointer)) == nullptr ||
+            addressSpace.getPhysicalAddress(reinterpret_cast<void*>(framePointer + sizeof(uint32_t))) == nullptr) {
+            break;
+        }
+
+        const auto *frame = reinterpret_cast<const uint32_t*>(framePointer);
+        auto returnAddress = frame[1];
+        if (returnAddress == 0 || returnAddress == 0x0000DEAD) {
+            break;
+        }
+
+        // A return address points behind the call instruction, which may already be the first byte of the next function
+        addresses[depth++] = returnAddress - 1;
+
+        // Stacks grow downwards, so the caller's frame must be located at a higher address
+        if (frame[0] <= framePointer) {
+            break;
+        }
+
+        framePointer = frame[0];
+    }
+
+    return depth;
+}
+
+void Profiler::resolveSymbols(const Process &process) {
+    const auto &header = Util::System::getAddressSpaceHeader();
+    const auto symbolCount = header.symbolTableSize / sizeof(Util::Io::Elf::SymbolEntry);
+    const auto processName = process.getName();
+    const auto processId = process.getId();
+
+    symbolLock.acquire();
+
+    for (const auto &buffer : buffers) {
+        if (buffer.samples == nullptr) {
+            continue;
+        }
+
+        const auto count = buffer.written < SAMPLES_PER_CPU ? buffer.written : SAMPLES_PER_CPU;
+        for (uint32_t i = 0; i < count; i++) {
+            const auto &sample = buffer.samples[i];
+            if (sample.processId != processId) {
+                continue;
+            }
+
+            for (uint32_t j = 0; j < sample.depth; j++) {
+                auto address = sample.addresses[j];
+                if (address < Util::USER_SPACE_MEMORY_START_ADDRESS) {
+                    continue;
+                }
+
+                bool known = false;
+                for (uint32_t k = 0; k < resolvedSymbols.size(); k++) {
+                    const auto *symbol = resolvedSymbols.get(k);
+                    if (symbol->processId == processId && address >= symbol->start && address < symbol->end) {
+                        known = true;
+                        break;
+                    }
+                }
+
+                for (uint32_t k = 0; !known && k < symbolCount; k++) {
+                    const auto &symbol = header.symbolTable[k];
+                    if (symbol.getSymbolType() == Util::Io::Elf::SymbolType::FUNC && address >= symbol.value && address - symbol.value < symbol.size) {
+                        resolvedSymbols.add(new ResolvedSymbol{processId, symbol.value, symbol.value + symbol.size, processName + ":" + (header.stringTable + symbol.nameOffset)});
+                        known = true;
+                    }
+                }
+            }
+        }
+    }
+
+    symbolLock.release();
+}
+
+uint32_t Profiler::getSampleCount() {
+    uint32_t count = 0;
+    for (const auto &buffer : buffers) {
+        count += buffer.written < SAMPLES_PER_CPU ? buffer.written : SAMPLES_PER_CPU;
+    }
+
+    return count;
+}
+
+uint32_t Profiler::getOverwrittenCount() {
+    uint32_t count = 0;
+    for (const auto &buffer : buffers) {
+        count += buffer.written < SAMPLES_PER_CPU ? 0 : buffer.written - SAMPLES_PER_CPU;
+    }
+
+    return count;
+}
+
+Util::String Profiler::getFlatReport() {
+    auto kernelSymbols = Util::HashMap<uint32_t, Util::String>();
+    auto selfCounts = Util::HashMap<Util::String, uint32_t>();
+    auto totalCounts = Util::HashMap<Util::String, uint32_t>();
+    auto sampleCount = getSampleCount();
+    Util::String names[MAX_DEPTH];
+
+    symbolLock.acquire();
+    for (const auto &buffer : buffers) {
+        const auto count = buffer.written < SAMPLES_PER_CPU ? buffer.written : SAMPLES_PER_CPU;
+        for (uint32_t i = 0; i < count; i++) {
+            const auto &sample = buffer.samples[i];
+            for (uint32_t j = 0; j < sample.depth; j++) {
+                names[j] = getSymbolName(sample.processId, sample.addresses[j], kernelSymbols);
+
+                // Count recursive functions only once per sample
+                bool duplicate = false;
+                for (uint32_t k = 0; k < j; k++) {
+                    if (names[k] == names[j]) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+
+                if (!duplicate) {
+                    addCount(totalCounts, names[j]);
+                }
+            }
+
+            addCount(selfCounts, names[0]);
+        }
+    }
+    symbolLock.release();
+
+    auto report = Util::String::format("Samples: %u (Overwritten: %u)\nSelf | Total | Function\n", sampleCount, getOverwrittenCount());
+    for (const auto &name : sortByCount(totalCounts)) {
+        auto selfCount = selfCounts.containsKey(name) ? selfCounts.get(name) : 0;
+        report += formatPercent(selfCount, sampleCount) + " | " + formatPercent(totalCounts.get(name), sampleCount) + " | " + name + "\n";
+    }
+
+    return report;
+}
+
+Util::String Profiler::getCallGraphReport() {
+    auto kernelSymbols = Util::HashMap<uint32_t, Util::String>();
+    auto edgeCounts = Util::HashMap<Util::String, uint32_t>();
+    auto sampleCount = getSampleCount();
+
+    symbolLock.acquire();
+    for (const auto &buffer : buffers) {
+        const auto count = buffer.written < SAMPLES_PER_CPU ? buffer.written : SAMPLES_PER_CPU;
+        for (uint32_t i = 0; i < count; i++) {
+            const auto &sample = buffer.samples[i];
+            auto callee = getSymbolName(sample.processId, sample.addresses[0], kernelSymbols);
+            for (uint32_t j = 1; j < sample.depth; j++) {
+                auto caller = getSymbolName(sample.processId, sample.addresses[j], kernelSymbols);
+                addCount(edgeCounts, caller + " -> " + callee);
+                callee = caller;
+            }
+        }
+    }
+    symbolLock.release();
+
+    auto report = Util::String::format("Samples: %u (Overwritten: %u)\nSamples | Caller -> Callee\n", sampleCount, getOverwrittenCount());
+    for (const auto &edge : sortByCount(edgeCounts)) {
+        report += formatPercent(edgeCounts.get(edge), sampleCount) + " | " + edge + "\n";
+    }
+
+    return report;
+}
+
+Util::String Profiler::getSymbolName(uint32_t processId, uint32_t address, Util::HashMap<uint32_t, Util::String> &kernelSymbols) {
+    if (address >= Util::USER_SPACE_MEMORY_START_ADDRESS) {
+        for (uint32_t i = 0; i < resolvedSymbols.size(); i++) {
+            const auto *symbol = resolvedSymbols.get(i);
+            if (symbol->processId == processId && address >= symbol->start && address < symbol->end) {
+                return symbol->name;
+            }
+        }
+
+        return Util::String::format("[%u]:0x%08x", processId, address);
+    }
+
+    if (kernelSymbols.containsKey(address)) {
+        return kernelSymbols.get(address);
+    }
+
+    uint32_t functionAddress = 0;
+    const char *name = nullptr;
+    if (Service::isServiceRegistered(InformationService::SERVICE_ID)) {
+        name = Service::getService<InformationService>().getFunctionName(address, functionAddress);
+    }
+
+    auto symbolName = name == nullptr ? Util::String::format("0x%08x", address) : Util::String(name);
+    kernelSymbols.put(address, symbolName);
+
+    return symbolName;
+}
+
+void Profiler::addCount(Util::HashMap<Util::String, uint32_t> &counts, const Util::String &key) {
+    counts.put(key, counts.containsKey(key) ? counts.get(key) + 1 : 1);
+}
+
+Util::Array<Util::String> Profiler::sortByCount(const Util::HashMap<Util::String, uint32_t> &counts) {
+    auto keys = counts.keys();
+
+    // Insertion sort in descending order (reports contain a few hundred entries at most)
+    for (uint32_t i = 1; i < keys.length(); i++) {
+        auto key = keys[i];
+        auto count = counts.get(key);
+
+        uint32_t j = i;
+        for (; j > 0 && counts.get(keys[j - 1]) < count; j--) {
+            keys[j] = keys[j - 1];
+        }
+
+        keys[j] = key;
+    }
+
+    return keys;
+}
+
+Util::String Profiler::formatPercent(uint32_t count, uint32_t total) {
+    auto permille = total == 0 ? 0 : static_cast<uint32_t>((static_cast<uint64_t>(count) * 1000) / total);
+    return Util::String::format("%u (%u.%u%c)", count, permille / 10, permille % 10, '%');
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PROFILER_H
+#define HHUOS_PROFILER_H
+
+#include <cstdint>
+
+#include "lib/util/base/String.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/HashMap.h"
+
+namespace Kernel {
+class Process;
+struct InterruptFrame;
+
+/**
+ * Sampling CPU profiler, driven by the timer interrupt (APIC timer on each core, or the PIT without APIC).
+ * On every tick, the interrupted instruction pointer and a short frame pointer backtrace are recorded
+ * into a ring buffer belonging to the interrupted CPU. Each ring buffer has a single producer (the timer interrupt
+ * of its CPU), so no locking is needed while sampling. When a buffer is full, the oldest samples are overwritten.
+ *
+ * Kernel addresses are symbolized via the kernel symbol table, when a report is generated.
+ * User space symbol tables are only mapped inside their own address space, so user addresses are symbolized,
+ * when the sampled process exits (see resolveSymbols()). Addresses of running processes are reported unresolved.
+ */
+class Profiler {
+
+public:
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    Profiler() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    Profiler(const Profiler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Profiler &operator=(const Profiler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Profiler() = default;
+
+    /**
+     * Discard all samples and start sampling. The ring buffers are allocated on the first call.
+     */
+    static void start();
+
+    static void stop();
+
+    [[nodiscard]] static bool isRunning();
+
+    /**
+     * Record a sample. Must be called by a timer interrupt handler with the frame of the interrupted code.
+     */
+    static void sample(const InterruptFrame &frame, uint8_t cpuId);
+
+    /**
+     * Symbolize all user space addresses, sampled in the given process.
+     * Must be called from inside the process' address space, before its memory is unmapped.
+     */
+    static void resolveSymbols(const Process &process);
+
+    [[nodiscard]] static uint32_t getSampleCount();
+
+    [[nodiscard]] static uint32_t getOverwrittenCount();
+
+    /**
+     * Generate a flat report, listing the functions by self samples (samples with the function on top of the stack)
+     * and total samples (samples with the function anywhere in the backtrace).
+     */
+    [[nodiscard]] static Util::String getFlatReport();
+
+    /**
+     * Generate a call graph report, listing all caller -> callee edges found in the backtraces by their sample count.
+     */
+    [[nodiscard]] static Util::String getCallGraphReport();
+
+    static const constexpr uint32_t MAX_DEPTH = 8;
+    static const constexpr uint32_t SAMPLES_PER_CPU = 2048;
+    static const constexpr uint32_t MAX_CPU_COUNT = 8;
+
+private:
+
+    struct Sample {
+        uint32_t processId;
+        uint32_t depth;
+        uint32_t addresses[MAX_DEPTH];
+    };
+
+    struct RingBuffer {
+        Sample *samples;
+        uint32_t written;
+    };
+
+    struct ResolvedSymbol {
+        uint32_t processId;
+        uint32_t start;
+        uint32_t end;
+        Util::String name;
+    };
+
+    static uint32_t captureBacktrace(uint32_t framePointer, uint32_t *addresses, uint32_t maxDepth);
+
+    static Util::String getSymbolName(uint32_t processId, uint32_t address, Util::HashMap<uint32_t, Util::String> &kernelSymbols);
+
+    static void addCount(Util::HashMap<Util::String, uint32_t> &counts, const Util::String &key);
+
+    static Util::Array<Util::String> sortByCount(const Util::HashMap<Util::String, uint32_t> &counts);
+
+    static Util::String formatPercent(uint32_t count, uint32_t total);
+
+    static bool running;
+    static RingBuffer buffers[MAX_CPU_COUNT];
+    static Util::ArrayList<ResolvedSymbol*> resolvedSymbols;
+    static Util::Async::Spinlock symbolLock;
+};
+
+}
+
+#endif
@@ -36,6 +36,9 @@
 #include "lib/util/base/HeapMemoryManager.h"
 #include "kernel/service/ProcessService.h"
 #include "kernel/memory/VirtualAddressSpace.h"
+#include "device/cpu/Cpu.h"
+#include "device/time/OneShotTimer.h"
+#include "kernel/log/Trace.h"
 
 namespace Kernel {
 
@@ -202,6 +205,7 @@ void Scheduler::yield(bool interrupt) {
         interruptService.sendEndOfInterrupt(vector);
     }
 
+    TRACEPOINT(THREAD_SWITCH, current->getId(), next->getId());
     Thread::switchThread(*current, *next);
 }
 
@@ -210,6 +214,11 @@ void Scheduler::switchFpuContext() {
         Util::Exception::throwException(Util::Exception::DEVICE_NOT_AVAILABLE, "FPU not found!");
     }
 
+    // FPU contexts are only allocated for threads, which actually use the FPU (done before locking, since it may allocate memory)
+    if (currentThread->getFpuContext() == nullptr) {
+        currentThread->initializeFpuContext();
+    }
+
     readyQueueLock.acquire();
 
     // Disable FPU monitoring (will be enabled by scheduler at next thread switch)
@@ -241,9 +250,18 @@ void Scheduler::unlockReadyQueue() {
 void Scheduler::block() {
     readyQueueLock.acquire();
 
-    do {
-        checkSleepList();
-    } while (readyQueue.isEmpty());
+    checkSleepList();
+    if (readyQueue.isEmpty()) {
+        while (readyQueue.isEmpty()) {
+            idle();
+            checkSleepList();
+        }
+
+        // The idle loop may have armed the timer for up to a second -> Give the next thread a regular time slice
+        if (oneShotTimer != nullptr) {
+            oneShotTimer->setNextExpiry(getTimeUntilNextWakeup(oneShotTimer->getTimeSlice()));
+        }
+    }
 
     auto *current = currentThread;
     auto *next = readyQueue.poll();
@@ -273,6 +291,11 @@ void Scheduler::sleep(const Util::Time::Timestamp &time) {
     sleepList.add(SleepEntry{currentThread, wakeupTime});
     sleepQueueLock.release();
 
+    // Make sure the timer fires in time, if the thread wants to sleep shorter than the current time slice
+    if (oneShotTimer != nullptr && time < oneShotTimer->getRemainingTime()) {
+        oneShotTimer->setNextExpiry(time);
+    }
+
     block();
 }
 
@@ -303,6 +326,58 @@ void Scheduler::checkSleepList() {
     }
 }
 
+void Scheduler::idle() {
+    // Halting with disabled interrupts would stop the CPU forever
+    if (!Device::Cpu::areInterruptsEnabled()) {
+        return;
+    }
+
+    auto &timeService = Service::getService<TimeService>();
+    auto idleStart = timeService.getSystemTime();
+
+    // Disable interrupts while arming the timer, so that it cannot fire before the CPU is halted.
+    // 'sti' takes effect only after the next instruction, so no interrupt can slip in between 'sti' and 'hlt'.
+    asm volatile ("cli");
+    if (oneShotTimer != nullptr) {
+        oneShotTimer->setNextExpiry(getTimeUntilNextWakeup(Util::Time::Timestamp::ofMilliseconds(MAX_IDLE_MILLISECONDS)));
+    }
+    asm volatile ("sti; hlt" : : : "memory");
+
+    idleTime += timeService.getSystemTime() - idleStart;
+}
+
+Util::Time::Timestamp Scheduler::getTimeUntilNextWakeup(const Util::Time::Timestamp &maximum) {
+    if (!sleepQueueLock.tryAcquire()) {
+        return maximum;
+    }
+
+    auto systemTime = Service::getService<TimeService>().getSystemTime();
+    auto ret = maximum;
+    for (uint32_t i = 0; i < sleepList.size(); i++) {
+        const auto &wakeupTime = sleepList.get(i).wakeupTime;
+        if (wakeupTime <= systemTime) {
+            ret = Util::Time::Timestamp();
+            break;
+        }
+
+        auto remaining = wakeupTime - systemTime;
+        if (remaining < ret) {
+            ret = remaining;
+        }
+    }
+
+    sleepQueueLock.release();
+    return ret;
+}
+
+Util::Time::Timestamp Scheduler::getIdleTime() const {
+    return idleTime;
+}
+
+void Scheduler::setOneShotTimer(Device::OneShotTimer *timer) {
+    oneShotTimer = timer;
+}
+
 void Scheduler::resetLastFpuThread(Thread &terminatedThread) {
     Util::Async::Atomic<uint32_t> wrapper(reinterpret_cast<uint32_t&>(lastFpuThread));
     wrapper.compareAndSet(reinterpret_cast<uint32_t>(&terminatedThread), 0);
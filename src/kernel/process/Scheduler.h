@@ -29,6 +29,7 @@
 
 namespace Device {
 class Fpu;
+class OneShotTimer;
 }  // namespace Device
 
 namespace Util {
@@ -124,12 +125,31 @@ public:
 
     void removeFromJoinMap(uint32_t threadId);
 
+    /**
+     * Let the scheduler program the given timer for the next time slice end or sleeper wakeup,
+     * instead of relying on a periodic tick.
+     */
+    void setOneShotTimer(Device::OneShotTimer *timer);
+
+    /**
+     * Get the time until the earliest sleeping thread needs to be woken up.
+     * Called from interrupt context, so the given maximum is returned, if the sleep list is currently locked.
+     */
+    [[nodiscard]] Util::Time::Timestamp getTimeUntilNextWakeup(const Util::Time::Timestamp &maximum);
+
+    /**
+     * Get the accumulated time, during which the CPU has been halted, because no thread was ready.
+     */
+    [[nodiscard]] Util::Time::Timestamp getIdleTime() const;
+
 private:
 
     void lockReadyQueue();
 
     void checkSleepList();
 
+    void idle();
+
     void resetLastFpuThread(Thread &terminatedThread);
 
     struct SleepEntry {
@@ -146,14 +166,21 @@ private:
     uint8_t *defaultFpuContext = nullptr;
     Thread *lastFpuThread = nullptr;
 
+    Device::OneShotTimer *oneShotTimer = nullptr;
+    Util::Time::Timestamp idleTime;
+
     Util::ArrayListBlockingQueue<Thread*> readyQueue;
-    Util::Async::Spinlock readyQueueLock;
+    Util::Async::Spinlock readyQueueLock{"Scheduler::readyQueue"};
 
     Util::ArrayList<SleepEntry> sleepList;
-    Util::Async::Spinlock sleepQueueLock;
+    // Plain spinlock, since the timer interrupt only uses tryAcquire(), which rarely succeeds on a contended ticket lock
+    Util::Async::Spinlock sleepQueueLock{"Scheduler::sleepQueue"};
 
     Util::HashMap<uint32_t, Util::ArrayList<Thread*>*> joinMap;
-    Util::Async::Spinlock joinLock;
+    // Plain spinlock as well, since ready(), exit() and kill() retry tryAcquire(), which fails as long as a ticket lock has waiters
+    Util::Async::Spinlock joinLock{"Scheduler::join"};
+
+    static const constexpr uint32_t MAX_IDLE_MILLISECONDS = 1000;
 };
 
 }
@@ -44,16 +44,15 @@ extern "C" void release_scheduler_lock() {
 namespace Kernel {
 
 Util::Async::IdGenerator<uint32_t> Thread::idGenerator;
+uint32_t *Thread::kernelStackPool[KERNEL_STACK_POOL_CAPACITY];
+uint32_t Thread::kernelStackPoolSize = 0;
+Util::Async::Spinlock Thread::kernelStackPoolLock;
 
 Thread::Thread(const Util::String &name, Process &parent, Util::Async::Runnable *runnable, uint32_t userInstructionPointer, uint32_t *kernelStack, uint32_t *userStack) :
-        id(idGenerator.next()), name(name), parent(parent), runnable(runnable), userInstructionPointer(userInstructionPointer), kernelStack(kernelStack), userStack(userStack),
-        fpuContext(static_cast<uint8_t*>(Service::getService<MemoryService>().allocateKernelMemory(512, 16))) {
-    auto defaultFpuContext = Util::Address<uint32_t>(Service::getService<ProcessService>().getScheduler().getDefaultFpuContext());
-    Util::Address<uint32_t>(fpuContext).copyRange(defaultFpuContext, 512);
-}
+        id(idGenerator.next()), name(name), parent(parent), runnable(runnable), userInstructionPointer(userInstructionPointer), kernelStack(kernelStack), userStack(userStack) {}
 
 Thread::~Thread() {
-    delete reinterpret_cast<uint8_t*>(kernelStack);
+    releaseKernelStack(kernelStack);
     delete fpuContext;
 
     if (isKernelThread()) {
@@ -62,7 +61,7 @@ Thread::~Thread() {
 }
 
 Thread& Thread::createKernelThread(const Util::String &name, Process &parent, Util::Async::Runnable *runnable) {
-    auto *stack = createKernelStack(STACK_SIZE);
+    auto *stack = createKernelStack();
     auto *thread = new Thread(name, parent, runnable, 0, stack, nullptr);
 
     thread->prepareKernelStack();
@@ -71,15 +70,13 @@ Thread& Thread::createKernelThread(const Util::String &name, Process &parent, Ut
 }
 
 Thread& Thread::createUserThread(const Util::String &name, Process &parent, uint32_t eip, Util::Async::Runnable *runnable) {
-    auto *kernelStack = Thread::createKernelStack(STACK_SIZE);
-    auto *userStack = Thread::createUserStack(STACK_SIZE);
+    auto *kernelStack = Thread::createKernelStack();
+    auto *userStack = Thread::createUserStack(parent);
     auto *thread = new Thread(name, parent, runnable, eip, kernelStack, userStack);
 
     thread->prepareKernelStack();
 
-    // Prepare user stack
-    Util::Address<uint32_t>(thread->userStack).setRange(0, STACK_SIZE);
-
+    // Prepare user stack (only the top of the stack is ever read before being written, so there is no need to clear all of it)
     const auto capacity = STACK_SIZE / sizeof(uint32_t);
     thread->userStack[capacity - 1] = 0x00DEAD00; // Dummy return address
 
@@ -90,7 +87,7 @@ Thread& Thread::createUserThread(const Util::String &name, Process &parent, uint
 }
 
 Thread& Thread::createMainUserThread(const Util::String &name, Process &parent, uint32_t eip, uint32_t argc, char **argv, void *envp, uint32_t heapStartAddress) {
-    auto *kernelStack = createKernelStack(STACK_SIZE);
+    auto *kernelStack = createKernelStack();
     auto *userStack = createMainUserStack();
     auto *thread = new Thread(name, parent, nullptr, eip, kernelStack, userStack);
 
@@ -114,8 +111,7 @@ Thread& Thread::createMainUserThread(const Util::String &name, Process &parent,
 }
 
 void Thread::prepareKernelStack() {
-    Util::Address<uint32_t>(kernelStack).setRange(0, STACK_SIZE);
-
+    // All values read by 'kickoffKernelThread()' are written explicitly, so recycled stacks do not need to be cleared
     const auto capacity = STACK_SIZE / sizeof(uint32_t);
     kernelStack[capacity - 1] = 0x0000DEAD; // Dummy return address
     kernelStack[capacity - 2] = reinterpret_cast<uint32_t>(kickoffKernelThread); // Address of 'kickoff_kernel_thread()'
@@ -204,6 +200,16 @@ uint8_t *Thread::getFpuContext() const {
     return fpuContext;
 }
 
+uint32_t* Thread::getUserStack() const {
+    return userStack;
+}
+
+void Thread::initializeFpuContext() {
+    fpuContext = static_cast<uint8_t*>(Service::getService<MemoryService>().allocateKernelMemory(FPU_CONTEXT_SIZE, 16));
+    auto defaultFpuContext = Util::Address<uint32_t>(Service::getService<ProcessService>().getScheduler().getDefaultFpuContext());
+    Util::Address<uint32_t>(fpuContext).copyRange(defaultFpuContext, FPU_CONTEXT_SIZE);
+}
+
 bool Thread::isKernelThread() const {
     return userStack == nullptr;
 }
@@ -212,14 +218,38 @@ void Thread::join() {
     Service::getService<ProcessService>().getScheduler().join(*this);
 }
 
-uint32_t* Thread::createKernelStack(uint32_t size) {
+uint32_t* Thread::createKernelStack() {
+    kernelStackPoolLock.acquire();
+    if (kernelStackPoolSize > 0) {
+        auto *stack = kernelStackPool[--kernelStackPoolSize];
+        return kernelStackPoolLock.releaseAndReturn(stack);
+    }
+    kernelStackPoolLock.release();
+
     auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
-    return static_cast<uint32_t*>(memoryService.allocateKernelMemory(size, 16));
+    return static_cast<uint32_t*>(memoryService.allocateKernelMemory(STACK_SIZE, 16));
 }
 
-uint32_t* Thread::createUserStack(uint32_t size) {
+void Thread::releaseKernelStack(uint32_t *stack) {
+    kernelStackPoolLock.acquire();
+    if (kernelStackPoolSize < KERNEL_STACK_POOL_CAPACITY) {
+        kernelStackPool[kernelStackPoolSize++] = stack;
+        kernelStackPoolLock.release();
+        return;
+    }
+    kernelStackPoolLock.release();
+
+    delete reinterpret_cast<uint8_t*>(stack);
+}
+
+uint32_t* Thread::createUserStack(Process &parent) {
+    auto *stack = parent.reuseUserStack();
+    if (stack != nullptr) {
+        return stack;
+    }
+
     auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
-    return static_cast<uint32_t*>(memoryService.allocateUserMemory(size, 16));
+    return static_cast<uint32_t*>(memoryService.allocateUserMemory(STACK_SIZE, 16));
 }
 
 uint32_t* Thread::createMainUserStack() {
@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "lib/util/base/String.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Util {
 namespace Async {
@@ -82,8 +83,14 @@ public:
 
     [[nodiscard]] Process& getParent() const;
 
+    /**
+     * Get the FPU save area of this thread.
+     * It is only allocated, once the thread uses the FPU for the first time. Before that, nullptr is returned.
+     */
     [[nodiscard]] uint8_t* getFpuContext() const;
 
+    [[nodiscard]] uint32_t* getUserStack() const;
+
     [[nodiscard]] bool isKernelThread() const;
 
     void join();
@@ -100,13 +107,21 @@ private:
 
     void prepareKernelStack();
 
+    /**
+     * Allocate the FPU save area and initialize it with the scheduler's default context.
+     * Called by the scheduler on the first device-not-available trap of this thread.
+     */
+    void initializeFpuContext();
+
     static void kickoffKernelThread();
 
     void switchToUserMode();
 
-    static uint32_t* createKernelStack(uint32_t size);
+    static uint32_t* createKernelStack();
 
-    static uint32_t* createUserStack(uint32_t size);
+    static void releaseKernelStack(uint32_t *stack);
+
+    static uint32_t* createUserStack(Process &parent);
 
     static uint32_t* createMainUserStack();
 
@@ -120,10 +135,17 @@ private:
     uint32_t *userStack;
     uint32_t *oldStackPointer;
 
-    uint8_t *fpuContext;
+    uint8_t *fpuContext = nullptr;
 
     static Util::Async::IdGenerator<uint32_t> idGenerator;
     static const constexpr uint32_t STACK_SIZE = 0x10000;
+    static const constexpr uint32_t KERNEL_STACK_POOL_CAPACITY = 16;
+    static const constexpr uint32_t FPU_CONTEXT_SIZE = 512;
+
+    // Kernel stacks of terminated threads, which are reused instead of allocating new ones
+    static uint32_t *kernelStackPool[KERNEL_STACK_POOL_CAPACITY];
+    static uint32_t kernelStackPoolSize;
+    static Util::Async::Spinlock kernelStackPoolLock;
 };
 
 }
@@ -71,6 +71,18 @@ const char* Kernel::InformationService::getSymbolName(uint32_t symbolAddress) {
     return nullptr;
 }
 
+const char* Kernel::InformationService::getFunctionName(uint32_t address, uint32_t &functionAddress) const {
+    for (uint32_t i = 0; i < symbolTableSize / sizeof(Util::Io::Elf::SymbolEntry); i++) {
+        const auto &symbol = *(symbolTable + i);
+        if (symbol.getSymbolType() == Util::Io::Elf::SymbolType::FUNC && address >= symbol.value && address - symbol.value < symbol.size) {
+            functionAddress = symbol.value;
+            return stringTable + symbol.nameOffset;
+        }
+    }
+
+    return nullptr;
+}
+
 void *Kernel::InformationService::mapElfSection(const Util::Io::Elf::SectionHeader &sectionHeader) {
     // Beware: 'sectionHeader.virtualAddress' refers to a physical address in this case, due to the bootloader using an identity mapping
     auto &memoryService = Kernel::Service::getService<Kernel::MemoryService>();
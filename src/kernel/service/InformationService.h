@@ -66,6 +66,15 @@ public:
 
     [[nodiscard]] const char* getSymbolName(uint32_t symbolAddress);
 
+    /**
+     * Search the kernel symbol table for the function, which contains the given address.
+     *
+     * @param address An arbitrary address inside the kernel code
+     * @param functionAddress Set to the start address of the function, if it has been found
+     * @return The function's name, or nullptr if the address is not covered by any function symbol
+     */
+    [[nodiscard]] const char* getFunctionName(uint32_t address, uint32_t &functionAddress) const;
+
     static const constexpr uint8_t SERVICE_ID = 9;
 
 private:
@@ -29,6 +29,7 @@
 #include "lib/util/base/Exception.h"
 #include "lib/util/io/stream/PrintStream.h"
 #include "lib/util/base/Constants.h"
+#include "kernel/log/Trace.h"
 
 namespace Kernel {
 
@@ -77,11 +78,14 @@ void InterruptService::handleException(const InterruptFrame &frame, uint32_t err
 }
 
 void InterruptService::dispatchInterrupt(const InterruptFrame &frame, InterruptVector slot) {
+    TRACEPOINT(INTERRUPT, slot);
     interruptDispatcher.dispatch(frame, slot);
 }
 
 void InterruptService::dispatchSystemCall(Util::System::Code code, uint16_t paramCount, va_list params, bool &result) {
+    TRACEPOINT(SYSTEM_CALL_BEGIN, code, paramCount);
     systemCallDispatcher.dispatch(code, paramCount, params, result);
+    TRACEPOINT(SYSTEM_CALL_END, result);
 }
 
 void InterruptService::allowHardwareInterrupt(Device::InterruptRequest interrupt) {
@@ -34,6 +34,8 @@
 #include "lib/util/base/Address.h"
 #include "lib/util/base/Constants.h"
 #include "device/system/Bios.h"
+#include "kernel/service/TimeService.h"
+#include "kernel/log/Trace.h"
 
 namespace Kernel {
 
@@ -337,6 +339,7 @@ void MemoryService::removeAddressSpace(VirtualAddressSpace &addressSpace) {
 void MemoryService::handlePageFault(uint32_t errorCode) {
     // The faulted linear address is stored in the cr2 register
     auto faultAddress = Device::Cpu::readCr2();
+    TRACEPOINT(PAGE_FAULT_BEGIN, faultAddress, errorCode);
 
     // Check for null pointer access
     if (faultAddress == 0) {
@@ -348,8 +351,16 @@ void MemoryService::handlePageFault(uint32_t errorCode) {
         Util::Exception::throwException(Util::Exception::ILLEGAL_PAGE_ACCESS, "Privilege level not sufficient to access page!");
     }
 
+    // The time page is shared by all processes -> Map the kernel's physical page read-only instead of allocating a new one
+    if ((faultAddress & ~(Util::PAGESIZE - 1)) == Util::TIME_PAGE_ADDRESS && Service::isServiceRegistered(TimeService::SERVICE_ID)) {
+        currentAddressSpace->map(Service::getService<TimeService>().getTimePagePhysicalAddress(), reinterpret_cast<void*>(Util::TIME_PAGE_ADDRESS), Paging::PRESENT | Paging::USER_ACCESSIBLE);
+        TRACEPOINT(PAGE_FAULT_END);
+        return;
+    }
+
     // Map the faulted Page
     map(reinterpret_cast<void*>(faultAddress), 1, Paging::PRESENT | Paging::WRITABLE | (faultAddress >= Kernel::MemoryLayout::KERNEL_AREA.endAddress ? Paging::USER_ACCESSIBLE : 0));
+    TRACEPOINT(PAGE_FAULT_END);
 }
 
 MemoryService::MemoryStatus MemoryService::getMemoryStatus() {
@@ -80,7 +80,7 @@ public:
 
 private:
 
-    Util::Async::Spinlock lock;
+    Util::Async::Spinlock lock{"NetworkService"};
     Util::HashMap<Util::String, Device::Network::NetworkDevice*> deviceMap;
     Network::NetworkStack networkStack;
 
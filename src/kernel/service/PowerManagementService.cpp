@@ -23,6 +23,7 @@
 #include "InterruptService.h"
 #include "kernel/service/Service.h"
 #include "lib/util/base/System.h"
+#include "lib/util/base/Gcov.h"
 #include "device/system/Machine.h"
 
 namespace Kernel {
@@ -48,6 +49,8 @@ PowerManagementService::PowerManagementService(Device::Machine *machine) : machi
 }
 
 void PowerManagementService::shutdownMachine() {
+    // Write profile counters of instrumented kernels, since the kernel never returns through its destructors
+    Util::Gcov::dump();
     machine->shutdown();
 }
 
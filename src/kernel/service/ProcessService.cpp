@@ -32,6 +32,7 @@
 #include "InterruptService.h"
 #include "kernel/service/Service.h"
 #include "kernel/process/SchedulerCleaner.h"
+#include "kernel/process/Profiler.h"
 
 namespace Util {
 namespace Async {
@@ -262,6 +263,11 @@ void ProcessService::exitCurrentProcess(int32_t exitCode) {
     process.killAllThreadsButCurrent();
     scheduler.ready(cleanerThread);
 
+    // Symbolize profiler samples before the process is reported as finished, so that they are resolved when joining it
+    if (!process.isKernelProcess()) {
+        Profiler::resolveSymbols(process);
+    }
+
     process.setExitCode(exitCode);
 
     lock.acquire();
@@ -27,6 +27,10 @@
 #include "ProcessService.h"
 #include "kernel/process/Scheduler.h"
 #include "device/time/WaitTimer.h"
+#include "MemoryService.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/base/Constants.h"
+#include "lib/util/time/TimePage.h"
 
 namespace Device {
 class Rtc;
@@ -35,6 +39,14 @@ class Rtc;
 namespace Kernel {
 
 TimeService::TimeService(Device::WaitTimer *waitTimer, Device::TimeProvider *timeProvider, Device::DateProvider *dateProvider) : waitTimer(waitTimer), timeProvider(timeProvider), dateProvider(dateProvider) {
+    // Allocate the time page in kernel memory, so that it can be updated from any address space.
+    // User space processes get the same physical page mapped read-only on their first access (see MemoryService::handlePageFault()).
+    auto &memoryService = Service::getService<MemoryService>();
+    auto *pageAddress = memoryService.allocateKernelMemory(Util::PAGESIZE, Util::PAGESIZE);
+    Util::Address<uint32_t>(pageAddress).setRange(0, Util::PAGESIZE);
+    timePage = reinterpret_cast<Util::Time::TimePage*>(pageAddress);
+    timePagePhysicalAddress = memoryService.getPhysicalAddress(pageAddress);
+
     Service::getService<InterruptService>().assignSystemCall(Util::System::GET_SYSTEM_TIME, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 1) {
             return false;
@@ -100,4 +112,12 @@ void TimeService::busyWait(const Util::Time::Timestamp &time) const {
     waitTimer->wait(time);
 }
 
+Util::Time::TimePage& TimeService::getTimePage() {
+    return *timePage;
+}
+
+void* TimeService::getTimePagePhysicalAddress() const {
+    return timePagePhysicalAddress;
+}
+
 }
\ No newline at end of file
@@ -31,6 +31,12 @@ class TimeProvider;
 class Rtc;
 }  // namespace Device
 
+namespace Util {
+namespace Time {
+class TimePage;
+}  // namespace Time
+}  // namespace Util
+
 namespace Kernel {
 
 class TimeService : public Service {
@@ -64,6 +70,13 @@ public:
 
     void busyWait(const Util::Time::Timestamp &time) const;
 
+    /**
+     * Get the time page, which is mapped read-only into every process at Util::TIME_PAGE_ADDRESS.
+     */
+    [[nodiscard]] Util::Time::TimePage& getTimePage();
+
+    [[nodiscard]] void* getTimePagePhysicalAddress() const;
+
     static const constexpr uint8_t SERVICE_ID = 6;
 
 private:
@@ -71,6 +84,9 @@ private:
     Device::WaitTimer *waitTimer;
     Device::TimeProvider *timeProvider;
     Device::DateProvider *dateProvider;
+
+    Util::Time::TimePage *timePage;
+    void *timePagePhysicalAddress;
 };
 
 }
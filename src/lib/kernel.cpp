@@ -311,6 +311,7 @@ void throwError(Util::Exception::Error error, const char *message) {
         auto &processService = Kernel::Service::getService<Kernel::ProcessService>();
         if (processService.getCurrentProcess().isKernelProcess()) {
             Device::Cpu::disableInterrupts();
+            Kernel::Log::flush();
 
             Util::System::out << "Kernel Panic: " << Util::Exception::getExceptionName(error) << " (" << message <<  ")" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
             printKernelStackTrace(false);
@@ -7,6 +7,7 @@ global __cxa_pure_virtual
 ; Import functions
 extern main
 extern initMemoryManager
+extern initCpuDispatch
 extern _exit
 
 ; Import linker symbols
@@ -29,6 +30,9 @@ _start:
     ; Initialize bss
     call clear_bss
 
+    ; Bind CPU specific variants of frequently used routines
+    call initCpuDispatch
+
     ; Initialize static variables
     call _init
 
@@ -2,18 +2,24 @@
 
 #include "lib/util/base/operators.h"
 #include "lib/util/base/Constants.h"
+#include "lib/util/base/CpuDispatch.h"
 #include "lib/util/base/FreeListMemoryManager.h"
 #include "lib/util/base/System.h"
 
 // Export functions
 extern "C" {
 void initMemoryManager(uint8_t *startAddress);
+void initCpuDispatch();
 void _exit(int32_t);
 }
 
 void initMemoryManager(uint8_t *startAddress) {
     auto *memoryManager = new (&Util::System::getAddressSpaceHeader().memoryManager) Util::FreeListMemoryManager();
-    memoryManager->initialize(startAddress, reinterpret_cast<uint8_t*>(Util::MAIN_STACK_START_ADDRESS - 1));
+    memoryManager->initialize(startAddress, reinterpret_cast<uint8_t*>(Util::TIME_PAGE_ADDRESS - 1));
+}
+
+void initCpuDispatch() {
+    Util::CpuDispatch::initialize();
 }
 
 void _exit(int32_t exitCode) {
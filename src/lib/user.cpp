@@ -32,6 +32,7 @@
 #include "lib/util/network/Socket.h"
 #include "lib/util/time/Date.h"
 #include "lib/util/time/Timestamp.h"
+#include "lib/util/time/TimePage.h"
 #include "lib/util/base/FreeListMemoryManager.h"
 
 namespace Util {
@@ -193,7 +194,7 @@ Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable
 
 Util::Async::Thread getCurrentThread() {
     uint32_t threadId;
-    Util::System::call(Util::System::GET_CURRENT_PROCESS, 1, &threadId);
+    Util::System::call(Util::System::GET_CURRENT_THREAD, 1, &threadId);
     return Util::Async::Thread(threadId);
 }
 
@@ -222,9 +223,8 @@ bool isSchedulerInitialized() {
 }
 
 Util::Time::Timestamp getSystemTime() {
-    Util::Time::Timestamp systemTime;
-    Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
-    return systemTime;
+    // Read the time base published by the kernel, instead of issuing a GET_SYSTEM_TIME system call
+    return reinterpret_cast<const Util::Time::TimePage*>(Util::TIME_PAGE_ADDRESS)->read();
 }
 
 Util::Time::Date getCurrentDate() {
@@ -25,6 +25,17 @@ AtomicBitmap::AtomicBitmap(uint32_t blockCount) : blocks(blockCount) {
     arraySize = (blockCount % 32 == 0) ? (blockCount / 32) : (blockCount / 32 + 1);
     bitmap = new uint32_t[arraySize];
     Address<uint32_t>(bitmap).setRange(0, arraySize * sizeof(uint32_t));
+
+    // Padding bits in the last word are marked as used, so that searches never return blocks beyond the bitmap's size
+    if (blockCount % 32 != 0) {
+        bitmap[arraySize - 1] = 0xffffffff >> (blockCount % 32);
+    }
+
+    if (arraySize >= SUMMARY_THRESHOLD) {
+        summarySize = (arraySize % 32 == 0) ? (arraySize / 32) : (arraySize / 32 + 1);
+        summary = new uint32_t[summarySize];
+        Address<uint32_t>(summary).setRange(0, summarySize * sizeof(uint32_t));
+    }
 }
 
 uint32_t AtomicBitmap::getSize() const {
@@ -41,6 +52,10 @@ void AtomicBitmap::set(uint32_t block) {
 
     Async::Atomic<uint32_t> bitmapWrapper(bitmap[index]);
     bitmapWrapper.bitSet(31 - bit);
+
+    if (bitmapWrapper.get() == 0xffffffff) {
+        markFull(index);
+    }
 }
 
 void AtomicBitmap::unset(uint32_t block) {
@@ -53,6 +68,7 @@ void AtomicBitmap::unset(uint32_t block) {
 
     Async::Atomic<uint32_t> bitmapWrapper(bitmap[index]);
     bitmapWrapper.bitReset(31 - bit);
+    markNotFull(index);
 }
 
 bool AtomicBitmap::check(uint32_t block, bool set) {
@@ -68,43 +84,217 @@ bool AtomicBitmap::check(uint32_t block, bool set) {
 }
 
 uint32_t AtomicBitmap::findAndSet() {
-    uint32_t i;
+    const auto startWord = nextFitWord;
+
+    auto block = findFreeBlock(startWord, arraySize, true);
+    if (block == INVALID_INDEX) {
+        block = findFreeBlock(0, startWord, true);
+    }
+
+    // The summary may be outdated -> Scan all words before giving up
+    if (block == INVALID_INDEX && summary != nullptr) {
+        block = findFreeBlock(0, arraySize, false);
+    }
 
-    for (i = 0; i < blocks; i++) {
-        uint32_t index = i / 32;
-        uint32_t bit = i % 32;
+    return block;
+}
+
+uint32_t AtomicBitmap::findAndUnset() {
+    for (uint32_t i = 0; i < arraySize; i++) {
+        Async::Atomic<uint32_t> bitmapWrapper(bitmap[i]);
+        const auto validMask = (i == arraySize - 1 && blocks % 32 != 0) ? ~(0xffffffff >> (blocks % 32)) : 0xffffffff;
 
-        Async::Atomic<uint32_t> bitmapWrapper(bitmap[index]);
-        if (!bitmapWrapper.bitTestAndSet(31 - bit)) {
-            break;
+        auto value = bitmapWrapper.get();
+        while ((value & validMask) != 0) {
+            const auto position = static_cast<uint32_t>(__builtin_clz(value & validMask));
+            if (bitmapWrapper.compareAndSet(value, value & ~(0x80000000 >> position))) {
+                markNotFull(i);
+                return i * 32 + position;
+            }
+
+            value = bitmapWrapper.get();
         }
     }
 
-    if (i == blocks) {
+    return INVALID_INDEX;
+}
+
+uint32_t AtomicBitmap::findAndSetRange(uint32_t count) {
+    if (count == 0 || count > blocks) {
         return INVALID_INDEX;
     }
 
-    return i;
+    if (count == 1) {
+        return findAndSet();
+    }
+
+    auto block = findNextFree(0);
+    while (count <= blocks - block) {
+        const auto used = findNextUsed(block, block + count);
+        if (used < block + count) {
+            block = findNextFree(used);
+            continue;
+        }
+
+        // Claim the run word by word. If another thread has taken one of its blocks in the meantime, release the claimed part and search again.
+        uint32_t claimed = 0;
+        while (claimed < count) {
+            const auto current = block + claimed;
+            const auto position = current % 32;
+            const auto bitCount = count - claimed < 32 - position ? count - claimed : 32 - position;
+
+            if (!setWordMask(current / 32, getRangeMask(position, bitCount))) {
+                unsetRange(block, claimed);
+                break;
+            }
+
+            claimed += bitCount;
+        }
+
+        if (claimed == count) {
+            return block;
+        }
+    }
+
+    return INVALID_INDEX;
 }
 
-uint32_t AtomicBitmap::findAndUnset() {
-    uint32_t i;
+void AtomicBitmap::unsetRange(uint32_t block, uint32_t count) {
+    if (block >= blocks) {
+        return;
+    }
+
+    count = count > blocks - block ? blocks - block : count;
+    while (count > 0) {
+        const auto position = block % 32;
+        const auto bitCount = count < 32 - position ? count : 32 - position;
+        unsetWordMask(block / 32, getRangeMask(position, bitCount));
+
+        block += bitCount;
+        count -= bitCount;
+    }
+}
 
-    for (i = 0; i < blocks; i++) {
-        uint32_t index = i / 32;
-        uint32_t bit = i % 32;
+uint32_t AtomicBitmap::findFreeBlock(uint32_t startWord, uint32_t endWord, bool useSummary) {
+    for (uint32_t i = startWord; i < endWord; i++) {
+        if (useSummary && summary != nullptr) {
+            // Skip words, which are marked as full in the summary (up to 32 words at once)
+            const auto summaryFree = ~Async::Atomic<uint32_t>(summary[i / 32]).get() & (0xffffffff << (i % 32));
+            if (summaryFree == 0) {
+                i = (i / 32) * 32 + 31;
+                continue;
+            }
 
-        Async::Atomic<uint32_t> bitmapWrapper(bitmap[index]);
-        if (bitmapWrapper.bitTestAndReset(31 - bit)) {
-            break;
+            i = (i / 32) * 32 + __builtin_ctz(summaryFree);
+            if (i >= endWord) {
+                break;
+            }
         }
+
+        Async::Atomic<uint32_t> bitmapWrapper(bitmap[i]);
+        auto value = bitmapWrapper.get();
+        while (value != 0xffffffff) {
+            const auto position = static_cast<uint32_t>(__builtin_clz(~value));
+            const auto newValue = value | (0x80000000 >> position);
+            if (bitmapWrapper.compareAndSet(value, newValue)) {
+                if (newValue == 0xffffffff) {
+                    markFull(i);
+                }
+
+                nextFitWord = i;
+                return i * 32 + position;
+            }
+
+            value = bitmapWrapper.get();
+        }
+
+        markFull(i);
     }
 
-    if (i == blocks) {
-        return INVALID_INDEX;
+    return INVALID_INDEX;
+}
+
+uint32_t AtomicBitmap::findNextFree(uint32_t block) const {
+    for (uint32_t i = block / 32; i < arraySize; i++) {
+        auto free = ~Async::Atomic<uint32_t>(bitmap[i]).get();
+        if (i == block / 32) {
+            free &= 0xffffffff >> (block % 32);
+        }
+
+        if (free != 0) {
+            const auto result = i * 32 + __builtin_clz(free);
+            return result < blocks ? result : blocks;
+        }
+    }
+
+    return blocks;
+}
+
+uint32_t AtomicBitmap::findNextUsed(uint32_t block, uint32_t limit) const {
+    for (uint32_t i = block / 32; i * 32 < limit; i++) {
+        auto used = Async::Atomic<uint32_t>(bitmap[i]).get();
+        if (i == block / 32) {
+            used &= 0xffffffff >> (block % 32);
+        }
+
+        if (used != 0) {
+            const auto result = i * 32 + __builtin_clz(used);
+            return result < limit ? result : limit;
+        }
     }
 
-    return i;
+    return limit;
 }
 
-}
\ No newline at end of file
+bool AtomicBitmap::setWordMask(uint32_t index, uint32_t mask) {
+    Async::Atomic<uint32_t> bitmapWrapper(bitmap[index]);
+
+    while (true) {
+        const auto value = bitmapWrapper.get();
+        if ((value & mask) != 0) {
+            return false;
+        }
+
+        if (bitmapWrapper.compareAndSet(value, value | mask)) {
+            if ((value | mask) == 0xffffffff) {
+                markFull(index);
+            }
+
+            return true;
+        }
+    }
+}
+
+void AtomicBitmap::unsetWordMask(uint32_t index, uint32_t mask) {
+    Async::Atomic<uint32_t> bitmapWrapper(bitmap[index]);
+
+    auto value = bitmapWrapper.get();
+    while (!bitmapWrapper.compareAndSet(value, value & ~mask)) {
+        value = bitmapWrapper.get();
+    }
+
+    markNotFull(index);
+}
+
+void AtomicBitmap::markFull(uint32_t index) {
+    if (summary != nullptr) {
+        Async::Atomic<uint32_t>(summary[index / 32]).bitSet(index % 32);
+    }
+}
+
+void AtomicBitmap::markNotFull(uint32_t index) {
+    if (summary != nullptr) {
+        Async::Atomic<uint32_t> summaryWrapper(summary[index / 32]);
+        if (summaryWrapper.bitTest(index % 32)) {
+            summaryWrapper.bitReset(index % 32);
+        }
+    }
+}
+
+uint32_t AtomicBitmap::getRangeMask(uint32_t firstBit, uint32_t bitCount) {
+    // Block positions are counted from the most significant bit
+    const auto lastBit = firstBit + bitCount;
+    return (0xffffffff >> firstBit) & (lastBit >= 32 ? 0xffffffff : ~(0xffffffff >> lastBit));
+}
+
+}
@@ -22,6 +22,13 @@
 
 namespace Util::Async {
 
+/**
+ * Thread-safe bitmap for allocating blocks. Block i is stored in bit (31 - i % 32) of word i / 32.
+ * Free blocks are searched a word at a time, starting at the word of the last allocation (next fit).
+ * Large bitmaps additionally keep a summary with one bit per word, marking words that have been observed to be full.
+ * The summary is only a hint (it may be outdated under concurrent access), so a search falls back to scanning
+ * all words, before reporting that no free block is left.
+ */
 class AtomicBitmap {
 
 public:
@@ -48,13 +55,46 @@ public:
 
     uint32_t findAndUnset();
 
+    /**
+     * Find a run of 'count' consecutive free blocks and mark all of them as used.
+     *
+     * @return The first block of the run, or INVALID_INDEX, if no such run exists
+     */
+    uint32_t findAndSetRange(uint32_t count);
+
+    /**
+     * Mark 'count' consecutive blocks, starting at 'block', as free.
+     */
+    void unsetRange(uint32_t block, uint32_t count);
+
     static const constexpr uint32_t INVALID_INDEX = 0xffffffff;
 
 private:
 
+    [[nodiscard]] uint32_t findFreeBlock(uint32_t startWord, uint32_t endWord, bool useSummary);
+
+    [[nodiscard]] uint32_t findNextFree(uint32_t block) const;
+
+    [[nodiscard]] uint32_t findNextUsed(uint32_t block, uint32_t limit) const;
+
+    bool setWordMask(uint32_t index, uint32_t mask);
+
+    void unsetWordMask(uint32_t index, uint32_t mask);
+
+    void markFull(uint32_t index);
+
+    void markNotFull(uint32_t index);
+
+    [[nodiscard]] static uint32_t getRangeMask(uint32_t firstBit, uint32_t bitCount);
+
     uint32_t *bitmap = nullptr;
+    uint32_t *summary = nullptr;
     uint32_t arraySize = 0;
+    uint32_t summarySize = 0;
     uint32_t blocks = 0;
+    uint32_t nextFitWord = 0;
+
+    static const constexpr uint32_t SUMMARY_THRESHOLD = 64;
 
 };
 
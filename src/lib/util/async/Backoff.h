@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BACKOFF_H
+#define HHUOS_BACKOFF_H
+
+#include <cstdint>
+
+namespace Util::Async {
+
+/**
+ * Exponential backoff for busy waiting loops.
+ * Each call to wait() doubles the amount of pause instructions executed, until the limit is reached.
+ * From then on, the calling thread yields the CPU instead, because hhuOS threads are preemptively scheduled
+ * and the lock holder may need the CPU to make progress.
+ */
+class Backoff {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    Backoff() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    Backoff(const Backoff &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Backoff &operator=(const Backoff &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Backoff() = default;
+
+    void wait();
+
+    void reset();
+
+private:
+
+    uint32_t delay = MIN_DELAY;
+
+    static const constexpr uint32_t MIN_DELAY = 1;
+    static const constexpr uint32_t MAX_DELAY = 1024;
+};
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Executor.h"
+
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/base/String.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Util::Async {
+
+Executor::Executor(uint32_t workerCount) : workerCount(workerCount == 0 ? 1 : workerCount),
+        queues(new TaskQueue[Executor::workerCount]), threadIds(new uint32_t[Executor::workerCount]) {
+    for (uint32_t i = 0; i < Executor::workerCount; i++) {
+        threadIds[i] = 0;
+    }
+
+    // The worker runnables are owned by their threads and deleted, once a thread has finished
+    for (uint32_t i = 0; i < Executor::workerCount; i++) {
+        auto thread = Thread::createThread(String::format("Executor-Worker-%u", i), new Worker(*this, i));
+        Atomic<uint32_t>(threadIds[i]).set(thread.getId());
+    }
+}
+
+Executor::~Executor() {
+    awaitZero(pendingTasks);
+    Atomic<uint32_t>(running).set(0);
+
+    for (uint32_t i = 0; i < workerCount; i++) {
+        Thread(threadIds[i]).join();
+    }
+
+    delete[] threadIds;
+    delete[] queues;
+}
+
+void Executor::submit(Runnable *task) {
+    Atomic<uint32_t>(pendingTasks).inc();
+
+    auto workerIndex = getCurrentWorkerIndex();
+    auto queueIndex = workerIndex >= 0 ? static_cast<uint32_t>(workerIndex) : Atomic<uint32_t>(nextQueue).fetchAndInc() % workerCount;
+    queues[queueIndex].pushBack(task);
+}
+
+void Executor::awaitZero(const uint32_t &counter) {
+    while (Atomic<uint32_t>(const_cast<uint32_t&>(counter)).get() > 0) {
+        if (!runPendingTask()) {
+            Thread::yield();
+        }
+    }
+}
+
+bool Executor::runPendingTask() {
+    auto workerIndex = getCurrentWorkerIndex();
+    auto *task = findTask(workerIndex >= 0 ? workerIndex : 0);
+    if (task == nullptr) {
+        return false;
+    }
+
+    runTask(task);
+    return true;
+}
+
+uint32_t Executor::getWorkerCount() const {
+    return workerCount;
+}
+
+void Executor::runWorker(uint32_t index) {
+    uint32_t idleRounds = 0;
+
+    while (Atomic<uint32_t>(running).get() != 0) {
+        auto *task = findTask(index);
+        if (task != nullptr) {
+            runTask(task);
+            idleRounds = 0;
+        } else if (idleRounds++ < IDLE_YIELD_ROUNDS) {
+            Thread::yield();
+        } else {
+            Thread::sleep(Time::Timestamp::ofMilliseconds(IDLE_SLEEP_MILLISECONDS));
+        }
+    }
+}
+
+Runnable* Executor::findTask(uint32_t startIndex) {
+    auto *task = queues[startIndex].popBack();
+    if (task != nullptr) {
+        return task;
+    }
+
+    for (uint32_t i = 1; i < workerCount; i++) {
+        task = queues[(startIndex + i) % workerCount].popFront();
+        if (task != nullptr) {
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+int32_t Executor::getCurrentWorkerIndex() const {
+    auto currentId = Thread::getCurrentThread().getId();
+    for (uint32_t i = 0; i < workerCount; i++) {
+        if (threadIds[i] == currentId) {
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    return -1;
+}
+
+void Executor::runTask(Runnable *task) {
+    task->run();
+    delete task;
+
+    Atomic<uint32_t>(pendingTasks).dec();
+}
+
+Executor::TaskQueue::~TaskQueue() {
+    delete[] tasks;
+}
+
+void Executor::TaskQueue::pushBack(Runnable *task) {
+    lock.acquire();
+
+    if (size == capacity) {
+        auto newCapacity = capacity == 0 ? 16 : capacity * 2;
+        auto **newTasks = new Runnable*[newCapacity];
+        for (uint32_t i = 0; i < size; i++) {
+            newTasks[i] = tasks[(head + i) % capacity];
+        }
+
+        delete[] tasks;
+        tasks = newTasks;
+        capacity = newCapacity;
+        head = 0;
+    }
+
+    tasks[(head + size) % capacity] = task;
+    size++;
+
+    lock.release();
+}
+
+Runnable* Executor::TaskQueue::popBack() {
+    lock.acquire();
+    if (size == 0) {
+        return lock.releaseAndReturn<Runnable*>(nullptr);
+    }
+
+    size--;
+    auto *task = tasks[(head + size) % capacity];
+    return lock.releaseAndReturn(task);
+}
+
+Runnable* Executor::TaskQueue::popFront() {
+    lock.acquire();
+    if (size == 0) {
+        return lock.releaseAndReturn<Runnable*>(nullptr);
+    }
+
+    auto *task = tasks[head];
+    head = (head + 1) % capacity;
+    size--;
+    return lock.releaseAndReturn(task);
+}
+
+Executor::Worker::Worker(Executor &executor, uint32_t index) : executor(executor), index(index) {}
+
+void Executor::Worker::run() {
+    executor.runWorker(index);
+}
+
+}
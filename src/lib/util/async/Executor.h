@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_EXECUTOR_H
+#define HHUOS_EXECUTOR_H
+
+#include <cstdint>
+
+#include "lib/util/async/Runnable.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Future.h"
+
+namespace Util::Async {
+
+/**
+ * Runs tasks on a fixed set of worker threads.
+ * Each worker owns a double ended task queue. Workers take tasks from the back of their own queue (most recently submitted first)
+ * and steal from the front of other workers' queues, once their own queue is empty. Idle workers yield their time slice
+ * and fall back to sleeping, if no work shows up for a while.
+ * Tasks submitted by a worker are pushed to its own queue, tasks submitted by other threads are distributed round robin.
+ */
+class Executor {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param workerCount The amount of worker threads (at least 1)
+     */
+    explicit Executor(uint32_t workerCount);
+
+    /**
+     * Copy Constructor.
+     */
+    Executor(const Executor &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Executor &operator=(const Executor &other) = delete;
+
+    /**
+     * Destructor.
+     * Waits for all submitted tasks to finish and stops the worker threads.
+     */
+    ~Executor();
+
+    /**
+     * Submit a task. The executor takes ownership and deletes the task after it has been run.
+     */
+    void submit(Runnable *task);
+
+    /**
+     * Submit a function (e.g. a lambda), which is copied into a task.
+     */
+    template<typename F>
+    void execute(const F &function);
+
+    /**
+     * Submit a function returning a value, which is delivered to the given future.
+     */
+    template<typename T, typename F>
+    void submit(Future<T> &future, const F &function);
+
+    /**
+     * Wait for a future, while executing pending tasks in the calling thread.
+     */
+    template<typename T>
+    const T& await(const Future<T> &future);
+
+    /**
+     * Wait until a counter (decremented by tasks) reaches zero, while executing pending tasks in the calling thread.
+     */
+    void awaitZero(const uint32_t &counter);
+
+    /**
+     * Take a pending task from any queue and run it in the calling thread.
+     *
+     * @return false, if no task has been available
+     */
+    bool runPendingTask();
+
+    [[nodiscard]] uint32_t getWorkerCount() const;
+
+private:
+
+    template<typename F>
+    class FunctionRunnable : public Runnable {
+
+    public:
+
+        explicit FunctionRunnable(const F &function) : function(function) {}
+
+        void run() override {
+            function();
+        }
+
+    private:
+
+        F function;
+    };
+
+    class TaskQueue {
+
+    public:
+
+        TaskQueue() = default;
+
+        TaskQueue(const TaskQueue &other) = delete;
+
+        TaskQueue &operator=(const TaskQueue &other) = delete;
+
+        ~TaskQueue();
+
+        void pushBack(Runnable *task);
+
+        Runnable* popBack();
+
+        Runnable* popFront();
+
+    private:
+
+        Spinlock lock;
+        Runnable **tasks = nullptr;
+        uint32_t capacity = 0;
+        uint32_t head = 0;
+        uint32_t size = 0;
+    };
+
+    class Worker : public Runnable {
+
+    public:
+
+        Worker(Executor &executor, uint32_t index);
+
+        void run() override;
+
+    private:
+
+        Executor &executor;
+        uint32_t index;
+    };
+
+    void runWorker(uint32_t index);
+
+    Runnable* findTask(uint32_t startIndex);
+
+    [[nodiscard]] int32_t getCurrentWorkerIndex() const;
+
+    void runTask(Runnable *task);
+
+    uint32_t workerCount;
+    TaskQueue *queues;
+    uint32_t *threadIds;
+
+    uint32_t running = 1;
+    uint32_t pendingTasks = 0;
+    uint32_t nextQueue = 0;
+
+    static const constexpr uint32_t IDLE_YIELD_ROUNDS = 64;
+    static const constexpr uint32_t IDLE_SLEEP_MILLISECONDS = 1;
+};
+
+template<typename F>
+void Executor::execute(const F &function) {
+    submit(new FunctionRunnable<F>(function));
+}
+
+template<typename T, typename F>
+void Executor::submit(Future<T> &future, const F &function) {
+    auto promise = Promise<T>(future);
+    execute([promise, function]() mutable {
+        promise.set(function());
+    });
+}
+
+template<typename T>
+const T& Executor::await(const Future<T> &future) {
+    while (!future.isDone()) {
+        if (!runPendingTask()) {
+            Thread::yield();
+        }
+    }
+
+    return future.get();
+}
+
+}
+
+#endif
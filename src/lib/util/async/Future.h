@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_FUTURE_H
+#define HHUOS_FUTURE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/Thread.h"
+
+namespace Util::Async {
+
+template<typename T>
+class Promise;
+
+/**
+ * Holds the result of an asynchronous computation, which is delivered by a Promise.
+ * The future is owned by the caller and must stay valid, until its promise has been fulfilled.
+ */
+template<typename T>
+class Future {
+
+friend class Promise<T>;
+
+public:
+    /**
+     * Default Constructor.
+     */
+    Future() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    Future(const Future &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Future &operator=(const Future &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Future() = default;
+
+    /**
+     * Check if the result is available without blocking.
+     */
+    [[nodiscard]] bool isDone() const;
+
+    /**
+     * Wait for the result by yielding the calling thread.
+     * Threads of an executor should use Executor::await() instead, which executes other tasks while waiting.
+     */
+    [[nodiscard]] const T& get() const;
+
+private:
+
+    T value{};
+    uint32_t done = 0;
+};
+
+/**
+ * Write side of a Future. Fulfilling the promise publishes the value to all threads waiting on the future.
+ */
+template<typename T>
+class Promise {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit Promise(Future<T> &future);
+
+    /**
+     * Copy Constructor.
+     */
+    Promise(const Promise &other) = default;
+
+    /**
+     * Assignment operator.
+     */
+    Promise &operator=(const Promise &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Promise() = default;
+
+    void set(const T &value);
+
+private:
+
+    Future<T> &future;
+};
+
+template<typename T>
+bool Future<T>::isDone() const {
+    return Atomic<uint32_t>(const_cast<uint32_t&>(done)).get() != 0;
+}
+
+template<typename T>
+const T& Future<T>::get() const {
+    while (!isDone()) {
+        Thread::yield();
+    }
+
+    return value;
+}
+
+template<typename T>
+Promise<T>::Promise(Future<T> &future) : future(future) {}
+
+template<typename T>
+void Promise<T>::set(const T &value) {
+    // The value must be visible before the done flag, which is guaranteed by the atomic (locked) exchange
+    future.value = value;
+    Atomic<uint32_t>(future.done).set(1);
+}
+
+}
+
+#endif
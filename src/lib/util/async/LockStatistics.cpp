@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "LockStatistics.h"
+
+namespace Util::Async {
+
+bool LockStatistics::enabled = false;
+LockStatistics *LockStatistics::first = nullptr;
+Spinlock LockStatistics::registryLock;
+
+LockStatistics::LockStatistics(const char *name) : name(name) {
+    registryLock.acquire();
+    next = first;
+    first = this;
+    registryLock.release();
+}
+
+LockStatistics::~LockStatistics() {
+    registryLock.acquire();
+    if (first == this) {
+        first = next;
+    } else {
+        for (auto *current = first; current != nullptr; current = current->next) {
+            if (current->next == this) {
+                current->next = next;
+                break;
+            }
+        }
+    }
+
+    registryLock.release();
+}
+
+void LockStatistics::onAcquire() {
+    if (!enabled) {
+        return;
+    }
+
+    acquisitions++;
+    acquireTimestamp = readTimestamp();
+}
+
+void LockStatistics::onContention(uint32_t spinCount) {
+    if (!enabled) {
+        return;
+    }
+
+    contentions++;
+    spins += spinCount;
+}
+
+void LockStatistics::onRelease() {
+    // A timestamp of 0 means, that the lock has been acquired while statistics were disabled
+    if (!enabled || acquireTimestamp == 0) {
+        return;
+    }
+
+    auto cycles = readTimestamp() - acquireTimestamp;
+    acquireTimestamp = 0;
+    holdCycles += cycles;
+    if (cycles > maxHoldCycles) {
+        maxHoldCycles = cycles;
+    }
+}
+
+const char* LockStatistics::getName() const {
+    return name;
+}
+
+uint32_t LockStatistics::getAcquisitions() const {
+    return acquisitions;
+}
+
+uint32_t LockStatistics::getContentions() const {
+    return contentions;
+}
+
+uint64_t LockStatistics::getSpins() const {
+    return spins;
+}
+
+uint64_t LockStatistics::getHoldCycles() const {
+    return holdCycles;
+}
+
+uint64_t LockStatistics::getMaxHoldCycles() const {
+    return maxHoldCycles;
+}
+
+void LockStatistics::reset() {
+    acquisitions = 0;
+    contentions = 0;
+    spins = 0;
+    holdCycles = 0;
+    maxHoldCycles = 0;
+}
+
+void LockStatistics::enable() {
+    enabled = true;
+}
+
+void LockStatistics::disable() {
+    enabled = false;
+}
+
+bool LockStatistics::isEnabled() {
+    return enabled;
+}
+
+void LockStatistics::forEach(void (*function)(const LockStatistics &, void *), void *argument) {
+    registryLock.acquire();
+    for (auto *current = first; current != nullptr; current = current->next) {
+        function(*current, argument);
+    }
+
+    registryLock.release();
+}
+
+uint64_t LockStatistics::readTimestamp() {
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_LOCKSTATISTICS_H
+#define HHUOS_LOCKSTATISTICS_H
+
+#include <cstdint>
+
+#include "Spinlock.h"
+
+namespace Util::Async {
+
+/**
+ * Contention statistics of a single named lock.
+ * Every named lock owns one instance, which registers itself in a global list on construction.
+ * Recording is disabled by default and can be switched on globally via enable(), so that unnamed locks
+ * and disabled statistics only cost a single branch per lock operation.
+ * All recording functions are called by the current holder of the lock, so the counters need no atomic updates.
+ * Hold times are measured in CPU cycles via the time stamp counter.
+ */
+class LockStatistics {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit LockStatistics(const char *name);
+
+    /**
+     * Copy Constructor.
+     */
+    LockStatistics(const LockStatistics &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    LockStatistics &operator=(const LockStatistics &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~LockStatistics();
+
+    /**
+     * Record a successful acquisition. Must be called by the new holder of the lock.
+     */
+    void onAcquire();
+
+    /**
+     * Record that the current acquisition had to wait for the given amount of spins.
+     * Must be called by the new holder of the lock, after onAcquire().
+     */
+    void onContention(uint32_t spins);
+
+    /**
+     * Record the release of the lock. Must be called before the lock is actually released.
+     */
+    void onRelease();
+
+    [[nodiscard]] const char* getName() const;
+
+    [[nodiscard]] uint32_t getAcquisitions() const;
+
+    [[nodiscard]] uint32_t getContentions() const;
+
+    [[nodiscard]] uint64_t getSpins() const;
+
+    [[nodiscard]] uint64_t getHoldCycles() const;
+
+    [[nodiscard]] uint64_t getMaxHoldCycles() const;
+
+    void reset();
+
+    static void enable();
+
+    static void disable();
+
+    [[nodiscard]] static bool isEnabled();
+
+    /**
+     * Call the given function for every registered lock statistics object.
+     * The registry is locked during the iteration, so the function must not create or destroy named locks.
+     */
+    static void forEach(void (*function)(const LockStatistics &statistics, void *argument), void *argument);
+
+    [[nodiscard]] static uint64_t readTimestamp();
+
+private:
+
+    const char *name;
+
+    uint32_t acquisitions = 0;
+    uint32_t contentions = 0;
+    uint64_t spins = 0;
+    uint64_t holdCycles = 0;
+    uint64_t maxHoldCycles = 0;
+    uint64_t acquireTimestamp = 0;
+
+    LockStatistics *next = nullptr;
+
+    static bool enabled;
+    static LockStatistics *first;
+    static Spinlock registryLock;
+};
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "McsLock.h"
+
+#include "Backoff.h"
+#include "LockStatistics.h"
+
+namespace Util::Async {
+
+McsLock::McsLock() : tailWrapper(tail) {}
+
+McsLock::McsLock(const char *name) : tailWrapper(tail), statistics(new LockStatistics(name)) {}
+
+McsLock::~McsLock() {
+    delete statistics;
+}
+
+void McsLock::acquire() {
+    auto &node = claimNode();
+    node.next = 0;
+    node.waiting = 1;
+
+    uint32_t spins = 0;
+    auto *predecessor = reinterpret_cast<QueueNode*>(tailWrapper.getAndSet(reinterpret_cast<uint32_t>(&node)));
+    if (predecessor != nullptr) {
+        Atomic<uint32_t>(predecessor->next).set(reinterpret_cast<uint32_t>(&node));
+
+        Backoff backoff;
+        auto waiting = Atomic<uint32_t>(node.waiting);
+        while (waiting.get() != 0) {
+            spins++;
+            backoff.wait();
+        }
+    }
+
+    owner = &node;
+    if (statistics != nullptr) {
+        statistics->onAcquire();
+        if (spins > 0) {
+            statistics->onContention(spins);
+        }
+    }
+}
+
+bool McsLock::tryAcquire() {
+    if (tailWrapper.get() != 0) {
+        return false;
+    }
+
+    auto &node = claimNode();
+    node.next = 0;
+    node.waiting = 0;
+
+    if (!tailWrapper.compareAndSet(0, reinterpret_cast<uint32_t>(&node))) {
+        freeNode(node);
+        return false;
+    }
+
+    owner = &node;
+    if (statistics != nullptr) {
+        statistics->onAcquire();
+    }
+
+    return true;
+}
+
+void McsLock::release() {
+    if (statistics != nullptr) {
+        statistics->onRelease();
+    }
+
+    auto *node = owner;
+    owner = nullptr;
+
+    auto next = Atomic<uint32_t>(node->next);
+    if (next.get() == 0) {
+        // No known successor -> Try to leave the queue empty
+        if (tailWrapper.compareAndSet(reinterpret_cast<uint32_t>(node), 0)) {
+            freeNode(*node);
+            return;
+        }
+
+        // Another thread has already swapped the tail, but not yet linked itself to this node
+        while (next.get() == 0) {
+            asm volatile ("pause" : : : "memory");
+        }
+    }
+
+    Atomic<uint32_t>(reinterpret_cast<QueueNode*>(next.get())->waiting).set(0);
+    freeNode(*node);
+}
+
+bool McsLock::isLocked() const {
+    return tailWrapper.get() != 0;
+}
+
+McsLock::QueueNode& McsLock::claimNode() {
+    Backoff backoff;
+    while (true) {
+        for (auto &node : nodes) {
+            if (Atomic<uint32_t>(node.used).compareAndSet(0, 1)) {
+                return node;
+            }
+        }
+
+        backoff.wait();
+    }
+}
+
+void McsLock::freeNode(QueueNode &node) {
+    Atomic<uint32_t>(node.used).set(0);
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_MCSLOCK_H
+#define HHUOS_MCSLOCK_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "Lock.h"
+
+namespace Util {
+namespace Async {
+class LockStatistics;
+}  // namespace Async
+}  // namespace Util
+
+namespace Util::Async {
+
+/**
+ * A fair queued spinlock after Mellor-Crummey and Scott.
+ * Waiting threads are appended to a queue and each of them spins only on its own queue node,
+ * so that releasing the lock touches exactly one waiter instead of all of them.
+ * Since the Lock interface does not allow callers to pass their own queue node, each lock owns a small pool of nodes.
+ * If all nodes are in use, additional callers back off until one becomes available.
+ */
+class McsLock : public Lock {
+
+public:
+    /**
+     * Constructor.
+     */
+    McsLock();
+
+    /**
+     * Create a named MCS lock, which records contention statistics (see LockStatistics).
+     */
+    explicit McsLock(const char *name);
+
+    /**
+     * Copy Constructor.
+     */
+    McsLock(const McsLock &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    McsLock &operator=(const McsLock &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~McsLock() override;
+
+    void acquire() override;
+
+    bool tryAcquire() override;
+
+    void release() override;
+
+    bool isLocked() const override;
+
+private:
+
+    struct QueueNode {
+        uint32_t next;
+        uint32_t waiting;
+        uint32_t used;
+    };
+
+    QueueNode& claimNode();
+
+    static void freeNode(QueueNode &node);
+
+    static const constexpr uint32_t QUEUE_NODES = 16;
+
+    QueueNode nodes[QUEUE_NODES]{};
+    QueueNode *owner = nullptr;
+
+    uint32_t tail = 0;
+    Atomic<uint32_t> tailWrapper;
+    LockStatistics *statistics = nullptr;
+};
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PARALLEL_H
+#define HHUOS_PARALLEL_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/Executor.h"
+#include "lib/util/collection/Array.h"
+
+namespace Util::Async {
+
+/**
+ * Call function(i) for each i in [begin, end) on the workers of an executor.
+ * The range is split into chunks of 'grainSize' iterations, each of which is run as a single task.
+ * The calling thread takes part in executing the chunks and returns, once all of them are finished.
+ */
+template<typename F>
+void parallelFor(Executor &executor, uint32_t begin, uint32_t end, uint32_t grainSize, const F &function) {
+    if (begin >= end) {
+        return;
+    }
+
+    grainSize = grainSize == 0 ? 1 : grainSize;
+    uint32_t remainingChunks = (end - begin + grainSize - 1) / grainSize;
+
+    for (uint32_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize) {
+        const auto chunkEnd = end - chunkBegin > grainSize ? chunkBegin + grainSize : end;
+        executor.execute([&function, &remainingChunks, chunkBegin, chunkEnd]() {
+            for (uint32_t i = chunkBegin; i < chunkEnd; i++) {
+                function(i);
+            }
+
+            Atomic<uint32_t>(remainingChunks).dec();
+        });
+    }
+
+    executor.awaitZero(remainingChunks);
+}
+
+/**
+ * Compute combine(...combine(combine(identity, map(begin)), map(begin + 1))..., map(end - 1)) on the workers of an executor.
+ * Each chunk of 'grainSize' iterations is reduced into its own partial result. The partial results are combined
+ * by the calling thread in ascending order, so the result is deterministic even for operations, which are not commutative.
+ */
+template<typename T, typename M, typename C>
+T parallelReduce(Executor &executor, uint32_t begin, uint32_t end, uint32_t grainSize, const T &identity, const M &map, const C &combine) {
+    if (begin >= end) {
+        return identity;
+    }
+
+    grainSize = grainSize == 0 ? 1 : grainSize;
+    const auto chunkCount = (end - begin + grainSize - 1) / grainSize;
+    auto partialResults = Array<T>(chunkCount);
+
+    parallelFor(executor, 0, chunkCount, 1, [&](uint32_t chunk) {
+        const auto chunkBegin = begin + chunk * grainSize;
+        const auto chunkEnd = end - chunkBegin > grainSize ? chunkBegin + grainSize : end;
+
+        T result = identity;
+        for (uint32_t i = chunkBegin; i < chunkEnd; i++) {
+            result = combine(result, map(i));
+        }
+
+        partialResults[chunk] = result;
+    });
+
+    T result = identity;
+    for (uint32_t i = 0; i < chunkCount; i++) {
+        result = combine(result, partialResults[i]);
+    }
+
+    return result;
+}
+
+}
+
+#endif
@@ -18,16 +18,19 @@
 #include "ReentrantSpinlock.h"
 
 #include "Thread.h"
+#include "LockStatistics.h"
 #include "lib/util/async/Atomic.h"
 #include "lib/interface.h"
 
 namespace Util::Async {
 
+ReentrantSpinlock::ReentrantSpinlock(const char *name) : Spinlock(name) {}
+
 bool ReentrantSpinlock::tryAcquire() {
     auto threadId = isSchedulerInitialized() ? Thread::getCurrentThread().getId() : 0;
     auto success = lockVarWrapper.compareAndSet(SPINLOCK_UNLOCK, threadId) || lockVarWrapper.compareAndSet(threadId, threadId);
-    if (success) {
-        depth++;
+    if (success && depth++ == 0 && statistics != nullptr) {
+        statistics->onAcquire();
     }
 
     return success;
@@ -40,6 +43,10 @@ void ReentrantSpinlock::release() {
     }
 
     if (depth == 0) {
+        if (statistics != nullptr && lockVarWrapper.get() == threadId) {
+            statistics->onRelease();
+        }
+
         lockVarWrapper.compareAndSet(threadId, SPINLOCK_UNLOCK);
     }
 }
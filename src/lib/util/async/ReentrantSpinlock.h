@@ -32,6 +32,11 @@ public:
      */
     ReentrantSpinlock() = default;
 
+    /**
+     * Create a named reentrant spinlock, which records contention statistics (see LockStatistics).
+     */
+    explicit ReentrantSpinlock(const char *name);
+
     /**
      * Copy Constructor.
      */
@@ -17,22 +17,44 @@
 
 #include "Thread.h"
 #include "Spinlock.h"
+#include "LockStatistics.h"
 
 namespace Util::Async {
 
 Spinlock::Spinlock() : lockVarWrapper(lockVar) {}
 
+Spinlock::Spinlock(const char *name) : lockVarWrapper(lockVar), statistics(new LockStatistics(name)) {}
+
+Spinlock::~Spinlock() {
+    delete statistics;
+}
+
 void Spinlock::acquire() {
+    uint32_t spins = 0;
     while (!tryAcquire()) {
+        spins++;
         Thread::yield();
     }
+
+    if (spins > 0 && statistics != nullptr) {
+        statistics->onContention(spins);
+    }
 }
 
 bool Spinlock::tryAcquire() {
-    return lockVarWrapper.compareAndSet(SPINLOCK_UNLOCK, SPINLOCK_LOCK);
+    auto success = lockVarWrapper.compareAndSet(SPINLOCK_UNLOCK, SPINLOCK_LOCK);
+    if (success && statistics != nullptr) {
+        statistics->onAcquire();
+    }
+
+    return success;
 }
 
 void Spinlock::release() {
+    if (statistics != nullptr) {
+        statistics->onRelease();
+    }
+
     lockVarWrapper.set(SPINLOCK_UNLOCK);
 }
 
@@ -23,6 +23,12 @@
 #include "lib/util/async/Atomic.h"
 #include "Lock.h"
 
+namespace Util {
+namespace Async {
+class LockStatistics;
+}  // namespace Async
+}  // namespace Util
+
 namespace Util::Async {
 
 /**
@@ -37,11 +43,16 @@ public:
 
     Spinlock();
 
+    /**
+     * Create a named spinlock, which records contention statistics (see LockStatistics).
+     */
+    explicit Spinlock(const char *name);
+
     Spinlock(const Spinlock &other) = delete;
 
     Spinlock &operator=(const Spinlock &other) = delete;
 
-    ~Spinlock() override = default;
+    ~Spinlock() override;
 
     void acquire() override;
 
@@ -55,6 +66,7 @@ protected:
 
     uint32_t lockVar = SPINLOCK_UNLOCK;
     Atomic<uint32_t> lockVarWrapper;
+    LockStatistics *statistics = nullptr;
 
     static const constexpr uint32_t SPINLOCK_UNLOCK = UINT32_MAX;
     static const constexpr uint32_t SPINLOCK_LOCK = 0x01;
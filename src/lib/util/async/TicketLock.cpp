@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TicketLock.h"
+
+#include "Backoff.h"
+#include "LockStatistics.h"
+
+namespace Util::Async {
+
+TicketLock::TicketLock() : nextTicketWrapper(nextTicket), nowServingWrapper(nowServing) {}
+
+TicketLock::TicketLock(const char *name) : nextTicketWrapper(nextTicket), nowServingWrapper(nowServing), statistics(new LockStatistics(name)) {}
+
+TicketLock::~TicketLock() {
+    delete statistics;
+}
+
+void TicketLock::acquire() {
+    auto ticket = nextTicketWrapper.fetchAndInc();
+
+    Backoff backoff;
+    uint32_t spins = 0;
+    while (nowServingWrapper.get() != ticket) {
+        spins++;
+        backoff.wait();
+    }
+
+    if (statistics != nullptr) {
+        statistics->onAcquire();
+        if (spins > 0) {
+            statistics->onContention(spins);
+        }
+    }
+}
+
+bool TicketLock::tryAcquire() {
+    // Only draw a ticket, if it would be served immediately
+    auto serving = nowServingWrapper.get();
+    auto success = nextTicketWrapper.compareAndSet(serving, serving + 1);
+    if (success && statistics != nullptr) {
+        statistics->onAcquire();
+    }
+
+    return success;
+}
+
+void TicketLock::release() {
+    if (statistics != nullptr) {
+        statistics->onRelease();
+    }
+
+    nowServingWrapper.inc();
+}
+
+bool TicketLock::isLocked() const {
+    return nextTicketWrapper.get() != nowServingWrapper.get();
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TICKETLOCK_H
+#define HHUOS_TICKETLOCK_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "Lock.h"
+
+namespace Util {
+namespace Async {
+class LockStatistics;
+}  // namespace Async
+}  // namespace Util
+
+namespace Util::Async {
+
+/**
+ * A fair spinlock, which grants the lock in the order of acquisition attempts.
+ * Each caller draws a ticket and waits (with exponential backoff) until its ticket is served.
+ * In contrast to an MCS lock, a ticket lock may be released by another thread than the one that acquired it.
+ */
+class TicketLock : public Lock {
+
+public:
+    /**
+     * Constructor.
+     */
+    TicketLock();
+
+    /**
+     * Create a named ticket lock, which records contention statistics (see LockStatistics).
+     */
+    explicit TicketLock(const char *name);
+
+    /**
+     * Copy Constructor.
+     */
+    TicketLock(const TicketLock &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TicketLock &operator=(const TicketLock &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TicketLock() override;
+
+    void acquire() override;
+
+    /**
+     * Take the lock only if it is free and nobody is waiting for it (i.e. the next ticket would be served immediately).
+     * Under contention, the lock is handed from one waiter to the next without ever becoming free,
+     * so tryAcquire() may fail repeatedly. Code that must not spin (e.g. interrupt handlers) should use a Spinlock instead.
+     */
+    bool tryAcquire() override;
+
+    void release() override;
+
+    bool isLocked() const override;
+
+private:
+
+    uint32_t nextTicket = 0;
+    uint32_t nowServing = 0;
+    Atomic<uint32_t> nextTicketWrapper;
+    Atomic<uint32_t> nowServingWrapper;
+    LockStatistics *statistics = nullptr;
+};
+
+}
+
+#endif
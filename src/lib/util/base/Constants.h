@@ -25,6 +25,7 @@ namespace Util {
 static const constexpr uint32_t PAGESIZE = 0x1000;
 static const constexpr uint32_t USER_SPACE_MEMORY_START_ADDRESS = 0x8000000;
 static const constexpr uint32_t MAIN_STACK_START_ADDRESS = 0xffff0000;
+static const constexpr uint32_t TIME_PAGE_ADDRESS = MAIN_STACK_START_ADDRESS - PAGESIZE;
 
 }
 
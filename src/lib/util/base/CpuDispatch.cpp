@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "CpuDispatch.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/base/MmxAddress.h"
+#include "lib/util/hardware/CpuId.h"
+#include "lib/util/math/Math.h"
+
+namespace Util {
+
+/*
+ * Vector types for the SSE variants. They are used via GCC vector extensions and builtins,
+ * because the intrinsic headers depend on the hosted C library.
+ * Vector128 is unaligned, so it can be used to load and store memory directly.
+ */
+typedef long long Vector128 __attribute__((vector_size(16), may_alias, aligned(1)));
+typedef long long Int64x2 __attribute__((vector_size(16)));
+typedef char Int8x16 __attribute__((vector_size(16)));
+typedef short Int16x8 __attribute__((vector_size(16)));
+typedef unsigned short Uint16x8 __attribute__((vector_size(16)));
+
+/**
+ * Combine the alpha value of a pixel with the additional opacity and map it to the range [0, 256],
+ * so that blending can be done with a shift instead of a division.
+ */
+static uint16_t scaleAlpha(uint8_t pixelAlpha, uint8_t alpha) {
+    const auto combined = static_cast<uint16_t>(alpha == 255 ? pixelAlpha : (pixelAlpha * alpha + 127) / 255);
+    return combined + (combined >> 7);
+}
+
+/* Generic (i386) variants */
+
+static void copyRangeGeneric(void *target, const void *source, uint32_t length) {
+    Address<uint32_t>(target).copyRange(Address<uint32_t>(source), length);
+}
+
+static void blendPixelsGeneric(uint32_t *target, const uint32_t *source, const uint8_t *sourceAlpha, uint32_t count, uint8_t alpha) {
+    for (uint32_t i = 0; i < count; i++) {
+        const uint32_t a = scaleAlpha(sourceAlpha[i], alpha);
+        const auto s = source[i];
+        const auto d = target[i];
+
+        // Blend two channels at once, each one occupying 16 bits of the intermediate result
+        const auto redBlue = (((s & 0x00ff00ff) * a + (d & 0x00ff00ff) * (256 - a)) >> 8) & 0x00ff00ff;
+        const auto alphaGreen = (((s >> 8) & 0x00ff00ff) * a + ((d >> 8) & 0x00ff00ff) * (256 - a)) & 0xff00ff00;
+        target[i] = redBlue | alphaGreen;
+    }
+}
+
+/* MMX variants (written in inline assembly, since intrinsics would require MMX code generation for the whole file) */
+
+static void copyRangeMmx(void *target, const void *source, uint32_t length) {
+    MmxAddress<uint32_t>(target).copyRange(Address<uint32_t>(source), length);
+    Math::endMmx();
+}
+
+static void blendPixelsMmx(uint32_t *target, const uint32_t *source, const uint8_t *sourceAlpha, uint32_t count, uint8_t alpha) {
+    // Factors for two pixels: source weights of both pixels, followed by target weights of both pixels
+    uint64_t weights[4];
+
+    while (count >= 2) {
+        for (uint32_t i = 0; i < 2; i++) {
+            const uint64_t a = scaleAlpha(sourceAlpha[i], alpha);
+            weights[i] = a * 0x0001000100010001;
+            weights[i + 2] = (256 - a) * 0x0001000100010001;
+        }
+
+        asm volatile (
+                "pxor %%mm7, %%mm7;"
+                "movq (%0), %%mm0;"
+                "movq %%mm0, %%mm4;"
+                "punpcklbw %%mm7, %%mm0;"
+                "punpckhbw %%mm7, %%mm4;"
+                "movq (%1), %%mm1;"
+                "movq %%mm1, %%mm5;"
+                "punpcklbw %%mm7, %%mm1;"
+                "punpckhbw %%mm7, %%mm5;"
+                "pmullw (%2), %%mm0;"
+                "pmullw 8(%2), %%mm4;"
+                "pmullw 16(%2), %%mm1;"
+                "pmullw 24(%2), %%mm5;"
+                "paddw %%mm1, %%mm0;"
+                "paddw %%mm5, %%mm4;"
+                "psrlw $8, %%mm0;"
+                "psrlw $8, %%mm4;"
+                "packuswb %%mm4, %%mm0;"
+                "movq %%mm0, (%1);"
+                : :
+                "r"(source),
+                "r"(target),
+                "r"(weights)
+                : "memory"
+                );
+
+        source += 2;
+        target += 2;
+        sourceAlpha += 2;
+        count -= 2;
+    }
+
+    Math::endMmx();
+    blendPixelsGeneric(target, source, sourceAlpha, count, alpha);
+}
+
+/* SSE2 variants */
+
+__attribute__((target("sse2")))
+static void copyRangeSse2(void *target, const void *source, uint32_t length) {
+    auto *targetBytes = static_cast<uint8_t*>(target);
+    const auto *sourceBytes = static_cast<const uint8_t*>(source);
+
+    for (; length >= 64; length -= 64, targetBytes += 64, sourceBytes += 64) {
+        const auto *sourceVectors = reinterpret_cast<const Vector128*>(sourceBytes);
+        const auto data0 = sourceVectors[0];
+        const auto data1 = sourceVectors[1];
+        const auto data2 = sourceVectors[2];
+        const auto data3 = sourceVectors[3];
+
+        auto *targetVectors = reinterpret_cast<Vector128*>(targetBytes);
+        targetVectors[0] = data0;
+        targetVectors[1] = data1;
+        targetVectors[2] = data2;
+        targetVectors[3] = data3;
+    }
+
+    copyRangeGeneric(targetBytes, sourceBytes, length);
+}
+
+__attribute__((target("sse2")))
+static void blendPixelsSse2(uint32_t *target, const uint32_t *source, const uint8_t *sourceAlpha, uint32_t count, uint8_t alpha) {
+    const auto zero = Int8x16{};
+
+    while (count >= 4) {
+        const auto a0 = static_cast<int16_t>(scaleAlpha(sourceAlpha[0], alpha));
+        const auto a1 = static_cast<int16_t>(scaleAlpha(sourceAlpha[1], alpha));
+        const auto a2 = static_cast<int16_t>(scaleAlpha(sourceAlpha[2], alpha));
+        const auto a3 = static_cast<int16_t>(scaleAlpha(sourceAlpha[3], alpha));
+        const auto weightsLow = Int16x8{a0, a0, a0, a0, a1, a1, a1, a1};
+        const auto weightsHigh = Int16x8{a2, a2, a2, a2, a3, a3, a3, a3};
+
+        const auto sourceData = reinterpret_cast<Int8x16>(*reinterpret_cast<const Vector128*>(source));
+        const auto targetData = reinterpret_cast<Int8x16>(*reinterpret_cast<const Vector128*>(target));
+
+        const auto low = reinterpret_cast<Int16x8>(__builtin_ia32_punpcklbw128(sourceData, zero)) * weightsLow
+                + reinterpret_cast<Int16x8>(__builtin_ia32_punpcklbw128(targetData, zero)) * (256 - weightsLow);
+        const auto high = reinterpret_cast<Int16x8>(__builtin_ia32_punpckhbw128(sourceData, zero)) * weightsHigh
+                + reinterpret_cast<Int16x8>(__builtin_ia32_punpckhbw128(targetData, zero)) * (256 - weightsHigh);
+
+        *reinterpret_cast<Vector128*>(target) = reinterpret_cast<Vector128>(__builtin_ia32_packuswb128(
+                reinterpret_cast<Int16x8>(reinterpret_cast<Uint16x8>(low) >> 8),
+                reinterpret_cast<Int16x8>(reinterpret_cast<Uint16x8>(high) >> 8)));
+
+        source += 4;
+        target += 4;
+        sourceAlpha += 4;
+        count -= 4;
+    }
+
+    blendPixelsGeneric(target, source, sourceAlpha, count, alpha);
+}
+
+/* SSE4.1 variants (routines without a benefit from SSE4.1 use their SSE2 variant) */
+
+__attribute__((target("sse4.1")))
+static void blendPixelsSse41(uint32_t *target, const uint32_t *source, const uint8_t *sourceAlpha, uint32_t count, uint8_t alpha) {
+    while (count >= 4) {
+        const auto a0 = static_cast<int16_t>(scaleAlpha(sourceAlpha[0], alpha));
+        const auto a1 = static_cast<int16_t>(scaleAlpha(sourceAlpha[1], alpha));
+        const auto a2 = static_cast<int16_t>(scaleAlpha(sourceAlpha[2], alpha));
+        const auto a3 = static_cast<int16_t>(scaleAlpha(sourceAlpha[3], alpha));
+        const auto weightsLow = Int16x8{a0, a0, a0, a0, a1, a1, a1, a1};
+        const auto weightsHigh = Int16x8{a2, a2, a2, a2, a3, a3, a3, a3};
+
+        // Fully transparent groups leave the target untouched
+        const auto weights = reinterpret_cast<Int64x2>(weightsLow | weightsHigh);
+        if (!__builtin_ia32_ptestz128(weights, weights)) {
+            const auto sourceData = *reinterpret_cast<const Vector128*>(source);
+            const auto targetData = *reinterpret_cast<const Vector128*>(target);
+            const auto sourceHigh = reinterpret_cast<Int8x16>(__builtin_ia32_psrldqi128(reinterpret_cast<Int64x2>(sourceData), 64));
+            const auto targetHigh = reinterpret_cast<Int8x16>(__builtin_ia32_psrldqi128(reinterpret_cast<Int64x2>(targetData), 64));
+
+            const auto low = __builtin_ia32_pmovzxbw128(reinterpret_cast<Int8x16>(sourceData)) * weightsLow
+                    + __builtin_ia32_pmovzxbw128(reinterpret_cast<Int8x16>(targetData)) * (256 - weightsLow);
+            const auto high = __builtin_ia32_pmovzxbw128(sourceHigh) * weightsHigh
+                    + __builtin_ia32_pmovzxbw128(targetHigh) * (256 - weightsHigh);
+
+            *reinterpret_cast<Vector128*>(target) = reinterpret_cast<Vector128>(__builtin_ia32_packuswb128(
+                    reinterpret_cast<Int16x8>(reinterpret_cast<Uint16x8>(low) >> 8),
+                    reinterpret_cast<Int16x8>(reinterpret_cast<Uint16x8>(high) >> 8)));
+        }
+
+        source += 4;
+        target += 4;
+        sourceAlpha += 4;
+        count -= 4;
+    }
+
+    blendPixelsGeneric(target, source, sourceAlpha, count, alpha);
+}
+
+static const CpuDispatch::Routines variants[CpuDispatch::VARIANT_COUNT] = {
+        { copyRangeGeneric, blendPixelsGeneric },
+        { copyRangeMmx, blendPixelsMmx },
+        { copyRangeSse2, blendPixelsSse2 },
+        { copyRangeSse2, blendPixelsSse41 }
+};
+
+CpuDispatch::Variant CpuDispatch::variant = GENERIC;
+const CpuDispatch::Routines *CpuDispatch::routines = &variants[GENERIC];
+
+void CpuDispatch::initialize() {
+    for (auto candidate = static_cast<int32_t>(SSE4_1); candidate >= GENERIC; candidate--) {
+        if (isSupported(static_cast<Variant>(candidate))) {
+            variant = static_cast<Variant>(candidate);
+            routines = &variants[candidate];
+            return;
+        }
+    }
+}
+
+bool CpuDispatch::isSupported(Variant variant) {
+    const auto features = Hardware::CpuId::getCpuFeatureBits();
+
+    switch (variant) {
+        case GENERIC:
+            return true;
+        case MMX:
+            return (features & Hardware::CpuId::MMX) != 0;
+        case SSE2:
+            return (features & Hardware::CpuId::SSE2) != 0;
+        case SSE4_1:
+            return (features & Hardware::CpuId::SSE2) != 0 && (features & Hardware::CpuId::SSE4_1) != 0;
+        default:
+            return false;
+    }
+}
+
+CpuDispatch::Variant CpuDispatch::getVariant() {
+    return variant;
+}
+
+const CpuDispatch::Routines& CpuDispatch::getRoutines() {
+    return *routines;
+}
+
+const CpuDispatch::Routines& CpuDispatch::getRoutines(Variant variant) {
+    return variants[variant];
+}
+
+const char* CpuDispatch::getVariantName(Variant variant) {
+    switch (variant) {
+        case GENERIC:
+            return "Generic";
+        case MMX:
+            return "MMX";
+        case SSE2:
+            return "SSE2";
+        case SSE4_1:
+            return "SSE4.1";
+        default:
+            return "Unknown";
+    }
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_CPUDISPATCH_H
+#define HHUOS_CPUDISPATCH_H
+
+#include <cstdint>
+
+namespace Util {
+
+/**
+ * Provides the fastest available implementation of frequently used routines.
+ * Each routine is compiled in several variants (using target attributes for the instruction set extensions),
+ * and the best variant supported by the CPU is bound once via initialize().
+ * Until then, the generic variants (plain i386 code) are used.
+ *
+ * The SIMD variants must not be used in kernel context: The kernel saves FPU/SSE registers lazily (only on #NM traps),
+ * so a system call or interrupt using them would silently overwrite the registers of the thread currently owning the FPU.
+ * Therefore, initialize() is only called by the user space runtime and kernel code uses the generic variants.
+ */
+class CpuDispatch {
+
+public:
+
+    enum Variant : uint8_t {
+        GENERIC,
+        MMX,
+        SSE2,
+        SSE4_1
+    };
+
+    struct Routines {
+        /**
+         * Copy a memory range (ranges must not overlap).
+         */
+        void (*copyRange)(void *target, const void *source, uint32_t length);
+
+        /**
+         * Blend 32-bit pixels onto a target. Each source pixel has its own alpha value,
+         * which is combined with an additional opacity, applied to all pixels.
+         */
+        void (*blendPixels)(uint32_t *target, const uint32_t *source, const uint8_t *sourceAlpha, uint32_t count, uint8_t alpha);
+    };
+
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    CpuDispatch() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    CpuDispatch(const CpuDispatch &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    CpuDispatch &operator=(const CpuDispatch &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~CpuDispatch() = default;
+
+    /**
+     * Bind the best variant supported by the CPU.
+     * Must be called once, after the FPU/SSE state has been enabled. Never call this in the kernel (see above).
+     */
+    static void initialize();
+
+    [[nodiscard]] static bool isSupported(Variant variant);
+
+    [[nodiscard]] static Variant getVariant();
+
+    [[nodiscard]] static const Routines& getRoutines();
+
+    [[nodiscard]] static const Routines& getRoutines(Variant variant);
+
+    [[nodiscard]] static const char* getVariantName(Variant variant);
+
+    static const constexpr uint32_t VARIANT_COUNT = 4;
+
+private:
+
+    static Variant variant;
+    static const Routines *routines;
+};
+
+}
+
+#endif
@@ -169,6 +169,7 @@ void* FreeListMemoryManager::allocAlgorithm(uint32_t size, uint32_t alignment, F
 
     current->next = nullptr;
     current->prev = nullptr;
+    allocationCount++;
 
     return reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(current) + HEADER_SIZE);
 }
@@ -387,6 +388,10 @@ uint8_t* FreeListMemoryManager::getEndAddress() const {
     return endAddress;
 }
 
+uint32_t FreeListMemoryManager::getAllocationCount() const {
+    return allocationCount;
+}
+
 void FreeListMemoryManager::disableAutomaticUnmapping() {
     unmapFreedMemory = false;
 }
@@ -107,6 +107,12 @@ public:
      */
     [[nodiscard]] bool isLocked() const override;
 
+    /**
+     * Get the number of chunks, that have been allocated by this memory manager since its initialization.
+     * This includes allocations performed internally by reallocateMemory().
+     */
+    [[nodiscard]] uint32_t getAllocationCount() const;
+
     void disableAutomaticUnmapping();
 
 private:
@@ -163,6 +169,7 @@ private:
 
     Util::Async::Spinlock lock;
     FreeListHeader *firstChunk = nullptr;
+    uint32_t allocationCount = 0;
     bool unmapFreedMemory = true;
 
     static const constexpr uint32_t MIN_BLOCK_SIZE = 4;
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Gcov.h"
+
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/ByteArrayOutputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
+
+/*
+ * Data structures emitted by GCC for each instrumented translation unit (see gcc/gcov-io.h and libgcc/libgcov.h).
+ * Only GCC 10 and newer are supported, older versions use a different set of counters.
+ */
+#if __GNUC__ >= 14
+#define GCOV_COUNTERS 9
+#else
+#define GCOV_COUNTERS 8
+#endif
+
+// Since GCC 12, record lengths are given in bytes instead of words
+#if __GNUC__ >= 12
+#define GCOV_UNIT_SIZE 4
+#else
+#define GCOV_UNIT_SIZE 1
+#endif
+
+struct GcovInfo;
+
+struct GcovCounterInfo {
+    uint32_t count;
+    int64_t *values;
+};
+
+struct GcovFunctionInfo {
+    const GcovInfo *key;
+    uint32_t ident;
+    uint32_t linenoChecksum;
+    uint32_t cfgChecksum;
+    GcovCounterInfo counters[1];
+};
+
+typedef void (*GcovMergeFunction)(int64_t *counters, uint32_t count);
+
+struct GcovInfo {
+    uint32_t version;
+    GcovInfo *next;
+    uint32_t stamp;
+#if __GNUC__ >= 12
+    uint32_t checksum;
+#endif
+    const char *filename;
+    GcovMergeFunction merge[GCOV_COUNTERS];
+    uint32_t functionCount;
+    const GcovFunctionInfo *const *functions;
+};
+
+// Export functions
+extern "C" {
+void __gcov_init(GcovInfo *info);
+void __gcov_exit();
+void __gcov_merge_add(int64_t *counters, uint32_t count);
+}
+
+static const constexpr uint32_t GCOV_DATA_MAGIC = 0x67636461;
+static const constexpr uint32_t GCOV_TAG_FUNCTION = 0x01000000;
+static const constexpr uint32_t GCOV_TAG_COUNTER_BASE = 0x01a10000;
+static const constexpr uint32_t GCOV_TAG_OBJECT_SUMMARY = 0xa1000000;
+static const constexpr uint32_t GCOV_COUNTER_ARCS = 0;
+
+static GcovInfo *infoList = nullptr;
+static bool dumped = false;
+
+void __gcov_init(GcovInfo *info) {
+    // Called by the constructors of instrumented translation units, before any memory management is available
+    info->next = infoList;
+    infoList = info;
+}
+
+void __gcov_exit() {
+    // Called by the destructors of instrumented translation units
+    Util::Gcov::dump();
+}
+
+void __gcov_merge_add(int64_t*, uint32_t) {
+    // Counters are merged on the host by tools/gcda.py, but the compiler references this function for arc counters
+}
+
+namespace Util {
+
+static void writeWord(Io::OutputStream &stream, uint32_t value) {
+    stream.write(value & 0xff);
+    stream.write((value >> 8) & 0xff);
+    stream.write((value >> 16) & 0xff);
+    stream.write((value >> 24) & 0xff);
+}
+
+static void writeCounter(Io::OutputStream &stream, int64_t value) {
+    writeWord(stream, static_cast<uint32_t>(value));
+    writeWord(stream, static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32));
+}
+
+static int64_t getMaximumArcCount() {
+    int64_t maximum = 0;
+    for (const auto *info = infoList; info != nullptr; info = info->next) {
+        if (info->merge[GCOV_COUNTER_ARCS] == nullptr) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < info->functionCount; i++) {
+            const auto *function = info->functions[i];
+            if (function == nullptr || function->key != info) {
+                continue;
+            }
+
+            const auto &arcs = function->counters[0];
+            for (uint32_t j = 0; j < arcs.count; j++) {
+                maximum = arcs.values[j] > maximum ? arcs.values[j] : maximum;
+            }
+        }
+    }
+
+    return maximum;
+}
+
+static void writeData(const GcovInfo &info, int64_t maximumArcCount, Io::OutputStream &stream) {
+    writeWord(stream, GCOV_DATA_MAGIC);
+    writeWord(stream, info.version);
+    writeWord(stream, info.stamp);
+#if __GNUC__ >= 12
+    writeWord(stream, info.checksum);
+#endif
+
+    // Each dump covers a single run, runs are accumulated when merging
+    writeWord(stream, GCOV_TAG_OBJECT_SUMMARY);
+    writeWord(stream, 2 * GCOV_UNIT_SIZE);
+    writeWord(stream, 1);
+    writeWord(stream, static_cast<uint32_t>(maximumArcCount));
+
+    for (uint32_t i = 0; i < info.functionCount; i++) {
+        const auto *function = info.functions[i];
+
+        // Functions emitted into several units (e.g. inline functions) are only written by the unit owning them
+        writeWord(stream, GCOV_TAG_FUNCTION);
+        if (function == nullptr || function->key != &info) {
+            writeWord(stream, 0);
+            continue;
+        }
+
+        writeWord(stream, 3 * GCOV_UNIT_SIZE);
+        writeWord(stream, function->ident);
+        writeWord(stream, function->linenoChecksum);
+        writeWord(stream, function->cfgChecksum);
+
+        // Only counters with a merge function are present in a function's counter array
+        const auto *counters = function->counters;
+        for (uint32_t type = 0; type < GCOV_COUNTERS; type++) {
+            if (info.merge[type] == nullptr) {
+                continue;
+            }
+
+            writeWord(stream, GCOV_TAG_COUNTER_BASE + (type << 17));
+            writeWord(stream, counters->count * 2 * GCOV_UNIT_SIZE);
+            for (uint32_t j = 0; j < counters->count; j++) {
+                writeCounter(stream, counters->values[j]);
+            }
+
+            counters++;
+        }
+    }
+}
+
+void Gcov::dump() {
+#if __GNUC__ >= 10
+    if (dumped || infoList == nullptr) {
+        return;
+    }
+
+    dumped = true;
+    auto file = Io::File(OUTPUT_PATH);
+    if (!file.exists()) {
+        return;
+    }
+
+    static const char *hexDigits = "0123456789abcdef";
+    const auto maximumArcCount = getMaximumArcCount();
+    auto outputStream = Io::FileOutputStream(file);
+
+    for (const auto *info = infoList; info != nullptr; info = info->next) {
+        auto data = Io::ByteArrayOutputStream();
+        writeData(*info, maximumArcCount, data);
+
+        // Build the whole line first, so that it is written with a single call
+        auto line = Io::ByteArrayOutputStream();
+        line.write(reinterpret_cast<const uint8_t*>("GCDA "), 0, 5);
+        for (const char *name = info->filename; *name != '\0'; name++) {
+            line.write(*name);
+        }
+        line.write(' ');
+
+        const auto *buffer = data.getBuffer();
+        for (uint32_t i = 0; i < data.getLength(); i++) {
+            line.write(hexDigits[buffer[i] >> 4]);
+            line.write(hexDigits[buffer[i] & 0x0f]);
+        }
+        line.write('\n');
+
+        outputStream.write(line.getBuffer(), 0, line.getLength());
+    }
+#endif
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_GCOV_H
+#define HHUOS_GCOV_H
+
+#include <cstdint>
+
+namespace Util {
+
+/**
+ * Freestanding runtime for GCC's profile instrumentation (used by builds with HHUOS_PGO=generate).
+ * Instrumented translation units register their counters via __gcov_init(), when their constructors are called.
+ * dump() serializes the counters of all registered units in the .gcda format and writes one line per unit
+ * to OUTPUT_PATH. The data is hex encoded, since it is usually written to a serial port:
+ *     GCDA <path of the .gcda file> <data>
+ * tools/gcda.py extracts these lines into .gcda files, merging the counters of units
+ * that are linked into several programs (e.g. the kernel and all applications share the base library).
+ * Value profiling is not supported, so instrumented code must be compiled with -fno-profile-values.
+ */
+class Gcov {
+
+public:
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    Gcov() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    Gcov(const Gcov &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Gcov &operator=(const Gcov &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Gcov() = default;
+
+    /**
+     * Write the counters of all registered translation units to OUTPUT_PATH.
+     * Only the first call has an effect, so that counters are not written twice.
+     * Nothing is written, if the program is not instrumented or OUTPUT_PATH does not exist.
+     */
+    static void dump();
+
+    static const constexpr char *OUTPUT_PATH = "/device/com2";
+};
+
+}
+
+#endif
@@ -17,6 +17,7 @@
 
 #include <cstdarg>
 #include <cstdint>
+#include <utility>
 
 #include "lib/interface.h"
 #include "lib/util/io/stream/ByteArrayOutputStream.h"
@@ -30,57 +31,110 @@
 namespace Util {
 
 String::String() noexcept {
-    len = 0;
-    buffer = new char[1];
-    buffer[0] = '\0';
+    initialize(nullptr, 0);
 }
 
 String::String(char character) noexcept {
-    len = 1;
-    buffer = new char[2];
-    buffer[0] = character;
-    buffer[1] = '\0';
+    initialize(&character, 1);
 }
 
 String::String(const char *string) noexcept {
-    auto address = Address<uint32_t>(string);
+    initialize(string, string == nullptr ? 0 : Address<uint32_t>(string).stringLength());
+}
+
+String::String(const uint8_t *data, uint32_t length) noexcept {
+    initialize(reinterpret_cast<const char*>(data), length);
+}
 
-    if (string == nullptr) {
-        len = 0;
+String::String(const String &other) noexcept {
+    initialize(other.buffer, other.len);
+}
+
+String::String(String &&other) noexcept {
+    if (other.isInline()) {
+        initialize(other.buffer, other.len);
     } else {
-        len = address.stringLength();
+        buffer = other.buffer;
+        len = other.len;
+        capacity = other.capacity;
     }
 
-    buffer = new char[len + 1];
-    Address<uint32_t>(buffer).copyRange(address, len);
-    buffer[len] = '\0';
+    other.initialize(nullptr, 0);
 }
 
-String::String(const uint8_t *data, uint32_t length) noexcept {
-    auto address = Address<uint32_t>(data);
+String::~String() {
+    if (!isInline()) {
+        delete[] buffer;
+    }
+}
 
+void String::initialize(const char *data, uint32_t length) {
     len = length;
-    buffer = new char[len + 1];
-    Address<uint32_t>(buffer).copyRange(address, len);
+
+    if (length <= INLINE_CAPACITY) {
+        buffer = inlineBuffer;
+        capacity = INLINE_CAPACITY;
+    } else {
+        buffer = new char[length + 1];
+        capacity = length;
+    }
+
+    if (length > 0) {
+        Address<uint32_t>(buffer).copyRange(Address<uint32_t>(data), length);
+    }
+
     buffer[len] = '\0';
 }
 
-String::String(const String &other) noexcept {
-    len = other.len;
-    buffer = new char[len + 1];
-    Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), len);
-    buffer[len] = '\0';
+bool String::isInline() const {
+    return buffer == inlineBuffer;
 }
 
-String::~String() {
-    delete[] buffer;
+void String::reserve(uint32_t newCapacity) {
+    if (newCapacity <= capacity) {
+        return;
+    }
+
+    auto *newBuffer = new char[newCapacity + 1];
+    Address<uint32_t>(newBuffer).copyRange(Address<uint32_t>(buffer), len + 1);
+
+    if (!isInline()) {
+        delete[] buffer;
+    }
+
+    buffer = newBuffer;
+    capacity = newCapacity;
+}
+
+void String::append(const char *data, uint32_t length) {
+    if (length == 0) {
+        return;
+    }
+
+    if (len + length > capacity) {
+        // Appending to itself -> Remember offset, since the buffer is about to be reallocated
+        bool isSelf = data >= buffer && data <= buffer + len;
+        uint32_t offset = isSelf ? data - buffer : 0;
+
+        reserve(len + length > capacity * 2 ? len + length : capacity * 2);
+
+        if (isSelf) {
+            data = buffer + offset;
+        }
+    }
+
+    Address<uint32_t>(buffer + len).copyRange(Address<uint32_t>(data), length);
+    len += length;
+    buffer[len] = '\0';
 }
 
 uint32_t String::hashCode() const {
-    uint32_t hash = 0;
+    // FNV-1a: Unlike a plain sum of all characters, this distributes similar strings (e.g. paths) across hash tables
+    uint32_t hash = 2166136261;
 
     for (uint32_t i = 0; i < len; i++) {
-        hash += buffer[i];
+        hash ^= static_cast<uint8_t>(buffer[i]);
+        hash *= 16777619;
     }
 
     return hash;
@@ -99,15 +153,7 @@ String String::substring(uint32_t begin, uint32_t end) const {
         end = len;
     }
 
-    uint32_t length = end - begin;
-    char *newBuffer = new char[length + 1];
-    Address<uint32_t>(newBuffer).copyRange(Address<uint32_t>(this->buffer + begin), length);
-    newBuffer[length] = '\0';
-
-    String ret(newBuffer);
-    delete[] newBuffer;
-
-    return ret;
+    return String(reinterpret_cast<const uint8_t*>(buffer + begin), end - begin);
 }
 
 Util::Array<String> String::split(const String &delimiter, uint32_t limit) const {
@@ -119,23 +165,18 @@ Util::Array<String> String::split(const String &delimiter, uint32_t limit) const
 
     uint32_t start = 0;
     uint32_t end = indexOf(delimiter);
-    String element;
 
     while (end != UINT32_MAX && result.size() + 1 != limit) {
-        element = substring(start, end);
-
-        if (!element.isEmpty()) {
-            result.add(element);
+        if (end > start) {
+            result.add(substring(start, end));
         }
 
         start = end + delimiter.len;
         end = indexOf(delimiter, start);
     }
 
-    element = substring(start, len);
-
-    if (!element.isEmpty()) {
-        result.add(element);
+    if (start < len) {
+        result.add(substring(start, len));
     }
 
     return result.toArray();
@@ -186,7 +227,7 @@ String String::remove(const String &string) const {
     uint32_t index = indexOf(string);
 
     if (index == UINT32_MAX) {
-        return String(buffer);
+        return *this;
     }
 
     return substring(0, index) + substring(index + string.len, len);
@@ -204,11 +245,19 @@ String String::removeAll(const String &string) const {
 }
 
 bool String::beginsWith(const String &string) const {
-    return substring(0, string.len) == string;
+    if (string.len > len) {
+        return false;
+    }
+
+    return Address<uint32_t>(buffer).compareRange(Address<uint32_t>(string.buffer), string.len) == 0;
 }
 
 bool String::endsWith(const String &string) const {
-    return substring(len - string.len, len) == string;
+    if (string.len > len) {
+        return false;
+    }
+
+    return Address<uint32_t>(buffer + len - string.len).compareRange(Address<uint32_t>(string.buffer), string.len) == 0;
 }
 
 
@@ -229,57 +278,120 @@ String &String::operator=(const String &other) {
         return *this;
     }
 
-    delete buffer;
-    buffer = nullptr;
-    len = other.len;
-    buffer = new char[len + 1];
+    if (other.len <= capacity) {
+        Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), other.len + 1);
+        len = other.len;
+        return *this;
+    }
+
+    if (!isInline()) {
+        delete[] buffer;
+    }
+
+    initialize(other.buffer, other.len);
+    return *this;
+}
+
+String &String::operator=(String &&other) noexcept {
+    if (&other == this) {
+        return *this;
+    }
+
+    if (other.isInline()) {
+        // Our own buffer always has room for at least INLINE_CAPACITY characters
+        Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), other.len + 1);
+        len = other.len;
+        return *this;
+    }
 
-    if (other.buffer != nullptr) {
-        Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), len + 1);
+    if (!isInline()) {
+        delete[] buffer;
     }
 
+    buffer = other.buffer;
+    len = other.len;
+    capacity = other.capacity;
+
+    other.initialize(nullptr, 0);
     return *this;
 }
 
 String &String::operator+=(const String &other) {
-    buffer = static_cast<char*>(reallocateMemory(buffer, len + other.len + 1));
-    Address<uint32_t>(buffer + len).copyRange(Address<uint32_t>(other.buffer), other.len + 1);
-    len += other.len;
+    append(other.buffer, other.len);
+    return *this;
+}
 
+String &String::operator+=(const char *other) {
+    if (other != nullptr) {
+        append(other, Address<uint32_t>(other).stringLength());
+    }
+
+    return *this;
+}
+
+String &String::operator+=(char other) {
+    append(&other, 1);
     return *this;
 }
 
 String operator+(const String &first, const String &second) {
-    String tmp = first;
-    tmp += second;
+    String tmp;
+    tmp.reserve(first.len + second.len);
+    tmp.append(first.buffer, first.len);
+    tmp.append(second.buffer, second.len);
 
     return tmp;
 }
 
 String operator+(const String &first, char second) {
-    String tmp = first;
-    tmp += String(second);
+    String tmp;
+    tmp.reserve(first.len + 1);
+    tmp.append(first.buffer, first.len);
+    tmp.append(&second, 1);
 
     return tmp;
 }
 
 String operator+(const String &first, const char *second) {
-    String tmp = first;
-    tmp += String(second);
+    String tmp;
+    uint32_t secondLength = second == nullptr ? 0 : Address<uint32_t>(second).stringLength();
+    tmp.reserve(first.len + secondLength);
+    tmp.append(first.buffer, first.len);
+    tmp.append(second, secondLength);
 
     return tmp;
 }
 
+String operator+(String &&first, const String &second) {
+    first += second;
+    return std::move(first);
+}
+
+String operator+(String &&first, char second) {
+    first += second;
+    return std::move(first);
+}
+
+String operator+(String &&first, const char *second) {
+    first += second;
+    return std::move(first);
+}
+
 String operator+(char first, const String &second) {
-    String tmp(first);
-    tmp += second;
+    String tmp;
+    tmp.reserve(second.len + 1);
+    tmp.append(&first, 1);
+    tmp.append(second.buffer, second.len);
 
     return tmp;
 }
 
 String operator+(const char *first, const String &second) {
-    String tmp(first);
-    tmp += second;
+    String tmp;
+    uint32_t firstLength = first == nullptr ? 0 : Address<uint32_t>(first).stringLength();
+    tmp.reserve(firstLength + second.len);
+    tmp.append(first, firstLength);
+    tmp.append(second.buffer, second.len);
 
     return tmp;
 }
@@ -313,11 +425,22 @@ String::operator uint32_t() const {
 }
 
 String String::join(const String &separator, const Util::Array<String> &elements) {
-    String tmp = "";
     uint32_t size = elements.length();
+    if (size == 0) {
+        return "";
+    }
+
+    uint32_t length = separator.len * (size - 1);
+    for (const auto &element : elements) {
+        length += element.len;
+    }
+
+    String tmp;
+    tmp.reserve(length);
 
     for (uint32_t i = 0; i < size - 1; i++) {
-        tmp += elements[i] + separator;
+        tmp += elements[i];
+        tmp += separator;
     }
 
     tmp += elements[size - 1];
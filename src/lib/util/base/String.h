@@ -29,6 +29,8 @@ namespace Util {
  */
 class String {
 
+friend class StringBuilder;
+
 public:
 
     String() noexcept;
@@ -41,6 +43,8 @@ public:
 
     String(const String &other) noexcept;
 
+    String(String &&other) noexcept;
+
     ~String();
 
     [[nodiscard]] uint32_t hashCode() const;
@@ -53,6 +57,12 @@ public:
 
     [[nodiscard]] bool isEmpty() const;
 
+    /**
+     * Make sure that the string can hold at least the given amount of characters without reallocating its buffer.
+     * Strings with up to INLINE_CAPACITY characters never need a heap allocation.
+     */
+    void reserve(uint32_t newCapacity);
+
     [[nodiscard]] String substring(uint32_t begin) const;
 
     [[nodiscard]] String substring(uint32_t begin, uint32_t end) const;
@@ -103,14 +113,26 @@ public:
 
     String &operator=(const String &other);
 
+    String &operator=(String &&other) noexcept;
+
     String &operator+=(const String &other);
 
+    String &operator+=(const char *other);
+
+    String &operator+=(char other);
+
     friend String operator+(const String &first, const String &second);
 
     friend String operator+(const String &first, char second);
 
     friend String operator+(const String &first, const char *second);
 
+    friend String operator+(String &&first, const String &second);
+
+    friend String operator+(String &&first, char second);
+
+    friend String operator+(String &&first, const char *second);
+
     friend String operator+(char first, const String &string);
 
     friend String operator+(const char *first, const String &second);
@@ -129,10 +151,20 @@ public:
 
     explicit operator uint32_t() const;
 
+    static const constexpr uint32_t INLINE_CAPACITY = 15;
+
 private:
 
+    [[nodiscard]] bool isInline() const;
+
+    void initialize(const char *data, uint32_t length);
+
+    void append(const char *data, uint32_t length);
+
     char *buffer;
     uint32_t len;
+    uint32_t capacity;
+    char inlineBuffer[INLINE_CAPACITY + 1];
 
     static const constexpr uint8_t CASE_OFFSET = 32;
 };
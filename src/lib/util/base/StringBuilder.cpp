@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <utility>
+
+#include "StringBuilder.h"
+
+namespace Util {
+
+StringBuilder::StringBuilder(uint32_t capacity) {
+    string.reserve(capacity);
+}
+
+StringBuilder& StringBuilder::append(const String &other) {
+    string += other;
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(const char *other) {
+    string += other;
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(const uint8_t *data, uint32_t length) {
+    string.append(reinterpret_cast<const char*>(data), length);
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(char character) {
+    string += character;
+    return *this;
+}
+
+uint32_t StringBuilder::length() const {
+    return string.length();
+}
+
+bool StringBuilder::isEmpty() const {
+    return string.isEmpty();
+}
+
+void StringBuilder::reset() {
+    string = String();
+}
+
+String StringBuilder::toString() const {
+    return string;
+}
+
+String StringBuilder::build() {
+    return std::move(string);
+}
+
+}
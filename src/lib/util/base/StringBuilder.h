@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_STRINGBUILDER_H
+#define HHUOS_STRINGBUILDER_H
+
+#include <cstdint>
+
+#include "lib/util/base/String.h"
+
+namespace Util {
+
+/**
+ * Builds a string from multiple parts, growing its buffer geometrically instead of
+ * allocating a new string for each concatenation.
+ */
+class StringBuilder {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    StringBuilder() = default;
+
+    /**
+     * Create a string builder with a preallocated buffer of the given capacity.
+     */
+    explicit StringBuilder(uint32_t capacity);
+
+    /**
+     * Copy Constructor.
+     */
+    StringBuilder(const StringBuilder &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    StringBuilder &operator=(const StringBuilder &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~StringBuilder() = default;
+
+    StringBuilder& append(const String &string);
+
+    StringBuilder& append(const char *string);
+
+    StringBuilder& append(const uint8_t *data, uint32_t length);
+
+    StringBuilder& append(char character);
+
+    [[nodiscard]] uint32_t length() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Discard the content, but keep the allocated buffer for reuse.
+     */
+    void reset();
+
+    /**
+     * Create a copy of the current content.
+     */
+    [[nodiscard]] String toString() const;
+
+    /**
+     * Move the content out of the builder without copying it. The builder is empty afterwards.
+     */
+    [[nodiscard]] String build();
+
+private:
+
+    String string;
+};
+
+}
+
+#endif
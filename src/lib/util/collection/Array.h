@@ -20,6 +20,8 @@
 
 #include <cstdint>
 #include <initializer_list>
+#include <utility>
+
 #include "lib/util/base/Exception.h"
 
 namespace Util {
@@ -42,8 +44,12 @@ public:
 
     Array(const Array<T> &other);
 
+    Array(Array<T> &&other) noexcept;
+
     Array<T> &operator=(const Array<T> &other);
 
+    Array<T> &operator=(Array<T> &&other) noexcept;
+
     T &operator[](uint32_t index);
 
     const T &operator[](uint32_t index) const;
@@ -97,8 +103,18 @@ Array<T>::Array(const Array<T> &other) {
     }
 }
 
+template <class T>
+Array<T>::Array(Array<T> &&other) noexcept : array(other.array), capacity(other.capacity) {
+    other.array = nullptr;
+    other.capacity = 0;
+}
+
 template <class T>
 Array<T> &Array<T>::operator=(const Array<T> &other) {
+    if (&other == this) {
+        return *this;
+    }
+
     delete[] array;
     capacity = other.capacity;
     array = new T[capacity];
@@ -110,6 +126,22 @@ Array<T> &Array<T>::operator=(const Array<T> &other) {
     return *this;
 }
 
+template <class T>
+Array<T> &Array<T>::operator=(Array<T> &&other) noexcept {
+    if (&other == this) {
+        return *this;
+    }
+
+    delete[] array;
+    array = other.array;
+    capacity = other.capacity;
+
+    other.array = nullptr;
+    other.capacity = 0;
+
+    return *this;
+}
+
 template <class T>
 T &Array<T>::operator[](uint32_t index) {
     if (index >= capacity) {
@@ -169,9 +201,9 @@ void Array<T>::sort(Array<T> &array) {
         hasChanged = false;
         for (uint32_t i = 0; i < length - 1; i++) {
             if (array[i] > array[i + 1]) {
-                T tmp = array[i];
-                array[i] = array[i + 1];
-                array[i + 1] = tmp;
+                T tmp = std::move(array[i]);
+                array[i] = std::move(array[i + 1]);
+                array[i + 1] = std::move(tmp);
                 hasChanged = true;
             }
         }
@@ -18,6 +18,8 @@
 #ifndef __ArrayList_include__
 #define __ArrayList_include__
 
+#include <utility>
+
 #include "lib/util/base/String.h"
 #include "List.h"
 
@@ -41,12 +43,18 @@ public:
 
     ArrayList(const ArrayList<T> &other) = delete;
 
+    ArrayList(ArrayList<T> &&other) noexcept;
+
     ArrayList<T> &operator=(const ArrayList<T> &other) = delete;
 
+    ArrayList<T> &operator=(ArrayList<T> &&other) noexcept;
+
     ~ArrayList();
 
     bool add(const T &element) override;
 
+    bool add(T &&element);
+
     void add(uint32_t index, const T &element) override;
 
     bool addAll(const Collection<T> &other) override;
@@ -111,6 +119,31 @@ ArrayList<T>::ArrayList(Array<T> elements) noexcept : ArrayList(elements.length(
     }
 }
 
+template<typename T>
+ArrayList<T>::ArrayList(ArrayList<T> &&other) noexcept : elements(other.elements), capacity(other.capacity), length(other.length) {
+    other.elements = nullptr;
+    other.capacity = 0;
+    other.length = 0;
+}
+
+template<typename T>
+ArrayList<T> &ArrayList<T>::operator=(ArrayList<T> &&other) noexcept {
+    if (&other == this) {
+        return *this;
+    }
+
+    delete[] elements;
+    elements = other.elements;
+    capacity = other.capacity;
+    length = other.length;
+
+    other.elements = nullptr;
+    other.capacity = 0;
+    other.length = 0;
+
+    return *this;
+}
+
 template <class T>
 ArrayList<T>::~ArrayList() {
     delete[] elements;
@@ -134,6 +167,15 @@ bool ArrayList<T>::add(const T &element) {
     return true;
 }
 
+template <class T>
+bool ArrayList<T>::add(T &&element) {
+    ensureCapacity(length + 1);
+    elements[length] = std::move(element);
+    length++;
+
+    return true;
+}
+
 template <class T>
 bool ArrayList<T>::addAll(const Collection<T> &other) {
     for (const T &element : other) {
@@ -152,7 +194,7 @@ void ArrayList<T>::add(uint32_t index, const T &element) {
     ensureCapacity(length + 1);
 
     for(uint32_t i = length; i > index; i--) {
-        elements[i] = elements[i - 1];
+        elements[i] = std::move(elements[i - 1]);
     }
 
     elements[index] = element;
@@ -177,12 +219,12 @@ T ArrayList<T>::removeIndex(uint32_t index) {
         Exception::throwException(Exception::OUT_OF_BOUNDS, "ArrayList: Trying to access an element out of bounds!");
     }
 
-    T tmp = elements[index];
+    T tmp = std::move(elements[index]);
     uint32_t numMoved = length - index - 1;
 
     if (numMoved != 0) {
         for(uint32_t i = 0; i < numMoved; i++) {
-            elements[index + i] = elements[index + i + 1];
+            elements[index + i] = std::move(elements[index + i + 1]);
         }
     }
 
@@ -248,7 +290,6 @@ void ArrayList<T>::ensureCapacity(uint32_t newCapacity) {
         return;
     }
 
-    uint32_t oldCapacity = capacity;
     while (capacity < newCapacity) {
         capacity *= 2;
     }
@@ -256,8 +297,8 @@ void ArrayList<T>::ensureCapacity(uint32_t newCapacity) {
     T* tmp = elements;
     elements = new T[capacity];
 
-    for (uint32_t i = 0; i < oldCapacity; i++) {
-        elements[i] = tmp[i];
+    for (uint32_t i = 0; i < length; i++) {
+        elements[i] = std::move(tmp[i]);
     }
 
     delete[] tmp;
@@ -270,7 +311,8 @@ Iterator<T> ArrayList<T>::begin() const {
 
 template <class T>
 Iterator<T> ArrayList<T>::end() const {
-    return Iterator<T>(toArray(), length);
+    // Iterators are only compared by index, so the end iterator does not need a copy of the elements
+    return Iterator<T>(Array<T>(0), length);
 }
 
 template <class T>
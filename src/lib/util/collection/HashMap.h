@@ -46,8 +46,12 @@ public:
 
     HashMap(const HashMap<K, V> &other) = delete;
 
+    HashMap(HashMap<K, V> &&other) noexcept;
+
     HashMap<K, V> &operator=(const HashMap<K, V> &other) = delete;
 
+    HashMap<K, V> &operator=(HashMap<K, V> &&other) noexcept;
+
     ~HashMap();
 
     void put(const K &key, const V &value) override;
@@ -70,9 +74,9 @@ private:
 
     void initialize() const;
 
-    mutable HashNode <K, V> **table;
+    mutable HashNode <K, V> **table = nullptr;
     mutable bool isInitialized = false;
-    const uint32_t tableSize;
+    uint32_t tableSize;
     uint32_t count;
 
     static const constexpr uint32_t DEFAULT_TABLE_SIZE = 47;
@@ -85,16 +89,49 @@ template<class K, class V>
 HashMap<K, V>::HashMap(uint32_t tableSize) noexcept : tableSize(tableSize), count(0) {}
 
 template<class K, class V>
-HashMap<K, V>::HashMap(std::initializer_list<Pair<K, V>> list) : tableSize(DEFAULT_TABLE_SIZE), count(list.size()) {
+HashMap<K, V>::HashMap(std::initializer_list<Pair<K, V>> list) : tableSize(DEFAULT_TABLE_SIZE), count(0) {
     for (auto &pair : list) {
         put(pair.first, pair.second);
     }
 }
 
+template<class K, class V>
+HashMap<K, V>::HashMap(HashMap<K, V> &&other) noexcept : table(other.table), isInitialized(other.isInitialized), tableSize(other.tableSize), count(other.count) {
+    other.table = nullptr;
+    other.isInitialized = false;
+    other.count = 0;
+}
+
+template<class K, class V>
+HashMap<K, V> &HashMap<K, V>::operator=(HashMap<K, V> &&other) noexcept {
+    if (&other == this) {
+        return *this;
+    }
+
+    if (isInitialized) {
+        clear();
+        delete[] table;
+    }
+
+    table = other.table;
+    isInitialized = other.isInitialized;
+    tableSize = other.tableSize;
+    count = other.count;
+
+    other.table = nullptr;
+    other.isInitialized = false;
+    other.count = 0;
+
+    return *this;
+}
+
 template<class K, class V>
 HashMap<K, V>::~HashMap() {
-    clear();
-    delete[] table;
+    // The table is only allocated on first use (and is handed over when a map is moved)
+    if (isInitialized) {
+        clear();
+        delete[] table;
+    }
 }
 
 template<class K, class V>
@@ -241,19 +278,20 @@ Array<K> HashMap<K, V>::keys() const {
         initialize();
     }
 
-    ArrayList<K> keyList;
+    Array<K> keyArray(count);
     HashNode<K, V> *current;
+    uint32_t index = 0;
 
     for (uint32_t i = 0; i < tableSize; i++) {
         current = table[i];
 
         while (current != nullptr) {
-            keyList.add(current->getKey());
+            keyArray[index++] = current->getKey();
             current = current->getNext();
         }
     }
 
-    return keyList.toArray();
+    return keyArray;
 }
 
 template<typename K, typename V>
@@ -262,19 +300,20 @@ Array<V> HashMap<K, V>::values() const {
         initialize();
     }
 
-    ArrayList<V> valueList;
+    Array<V> valueArray(count);
     HashNode<K, V> *current;
+    uint32_t index = 0;
 
     for (uint32_t i = 0; i < tableSize; i++) {
         current = table[i];
 
         while (current != nullptr) {
-            valueList.add(current->getValue());
+            valueArray[index++] = current->getValue();
             current = current->getNext();
         }
     }
 
-    return valueList.toArray();
+    return valueArray;
 }
 
 }
@@ -18,6 +18,8 @@
 #ifndef __Iterator_include__
 #define __Iterator_include__
 
+#include <utility>
+
 #include "Array.h"
 
 namespace Util {
@@ -57,7 +59,7 @@ private:
 };
 
 template <class T>
-Iterator<T>::Iterator(Array<T> array, uint32_t index) : array(array), index(index) {}
+Iterator<T>::Iterator(Array<T> array, uint32_t index) : array(std::move(array)), index(index) {}
 
 template <class T>
 Iterator<T>::Iterator(const Iterator<T> &other) : array(other.array), index(other.index) {}
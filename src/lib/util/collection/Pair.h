@@ -19,6 +19,7 @@
 #define __Pair_include__
 
 #include <cstdint>
+#include <utility>
 
 namespace Util {
 
@@ -38,8 +39,12 @@ public:
 
     Pair(const Pair &other) = default;
 
+    Pair(Pair &&other) noexcept = default;
+
     Pair &operator=(const Pair &other) = default;
 
+    Pair &operator=(Pair &&other) noexcept = default;
+
     bool operator!=(const Pair &other) const;
 
     bool operator==(const Pair &other) const;
@@ -53,7 +58,7 @@ public:
 };
 
 template<typename T, typename U>
-Pair<T, U>::Pair(T first, U second) : first(first), second(second) {}
+Pair<T, U>::Pair(T first, U second) : first(std::move(first)), second(std::move(second)) {}
 
 template<typename T, typename U>
 bool Pair<T, U>::operator!=(const Pair &other) const {
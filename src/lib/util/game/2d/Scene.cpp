@@ -23,7 +23,7 @@
 
 #include "Scene.h"
 
-#include "lib/util/collection/Pair.h"
+#include "lib/util/collection/Array.h"
 #include "lib/util/game/2d/event/CollisionEvent.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/Iterator.h"
@@ -50,32 +50,74 @@ void Scene::updateEntities(double delta) {
 }
 
 void Scene::checkCollisions() {
-    auto detectedCollisions = ArrayList<Pair<Util::Game::D2::Entity*, Util::Game::D2::Entity*>>();
+    collisionCheckCounter = 0;
+    collisionCounter = 0;
+
+    // Particles never act as obstacles, so only other entities are sorted into the grid.
+    // The cell size is derived from the average collider size, so that most colliders occupy only a few cells.
+    double extentSum = 0;
+    uint32_t obstacleCount = 0;
     for (auto *entity : entities) {
         auto *entity2D = reinterpret_cast<Util::Game::D2::Entity*>(entity);
-        if (entity2D->hasCollider() && entity2D->positionChanged) {
+        if (entity2D->hasCollider() && !entity2D->isParticle()) {
             const auto &collider = entity2D->getCollider();
+            extentSum += collider.getWidth() > collider.getHeight() ? collider.getWidth() : collider.getHeight();
+            obstacleCount++;
+        }
+    }
+
+    if (obstacleCount == 0) {
+        return;
+    }
 
-            for (auto *otherEntity : entities) {
-                auto *otherEntity2D = reinterpret_cast<Util::Game::D2::Entity*>(otherEntity);
-                if (entity == otherEntity || !otherEntity2D->hasCollider() || otherEntity2D->isParticle() || detectedCollisions.contains(Pair(entity2D, otherEntity2D)) || detectedCollisions.contains(Pair(otherEntity2D, entity2D))) {
-                    continue;
-                }
+    const auto averageExtent = extentSum / obstacleCount;
+    spatialHash.reset(averageExtent > 0 ? averageExtent * 2 : 1, entities.size());
 
-                const auto &otherCollider = otherEntity2D->getCollider();
-                auto side = collider.isColliding(otherCollider);
+    for (uint32_t i = 0; i < entities.size(); i++) {
+        auto *entity2D = reinterpret_cast<Util::Game::D2::Entity*>(entities.get(i));
+        if (entity2D->hasCollider() && !entity2D->isParticle()) {
+            spatialHash.insert(i, entity2D->getCollider());
+        }
+    }
 
-                if (side != RectangleCollider::NONE) {
-                    auto event = CollisionEvent(*otherEntity2D, side);
-                    auto otherEvent = CollisionEvent(*entity2D, RectangleCollider::getOpposite(side));
+    // A pair only needs to be checked once: If the other entity has already been checked as a moving entity,
+    // the pair has been handled before (and collision events have already been delivered to both entities).
+    // This does not hold for particles: They are not part of the grid, so no other entity has ever found them as a candidate.
+    auto checked = Array<bool>(entities.size());
+    for (uint32_t i = 0; i < entities.size(); i++) {
+        auto *entity2D = reinterpret_cast<Util::Game::D2::Entity*>(entities.get(i));
+        checked[i] = false;
 
-                    entity2D->onCollision(event);
-                    otherEntity2D->onCollision(otherEvent);
+        if (!entity2D->hasCollider() || !entity2D->positionChanged) {
+            continue;
+        }
 
-                    detectedCollisions.add(Pair(entity2D, otherEntity2D));
-                }
+        const auto &collider = entity2D->getCollider();
+        const auto inGrid = !entity2D->isParticle();
+        spatialHash.query(collider, collisionCandidates);
+
+        for (auto j : collisionCandidates) {
+            if (j == i || (inGrid && j < i && checked[j])) {
+                continue;
+            }
+
+            auto *otherEntity2D = reinterpret_cast<Util::Game::D2::Entity*>(entities.get(j));
+            const auto &otherCollider = otherEntity2D->getCollider();
+            auto side = collider.isColliding(otherCollider);
+            collisionCheckCounter++;
+
+            if (side != RectangleCollider::NONE) {
+                auto event = CollisionEvent(*otherEntity2D, side);
+                auto otherEvent = CollisionEvent(*entity2D, RectangleCollider::getOpposite(side));
+
+                entity2D->onCollision(event);
+                otherEntity2D->onCollision(otherEvent);
+
+                collisionCounter++;
             }
         }
+
+        checked[i] = true;
     }
 }
 
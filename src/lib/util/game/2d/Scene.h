@@ -24,7 +24,11 @@
 #ifndef HHUOS_SCENE_2D_H
 #define HHUOS_SCENE_2D_H
 
+#include <cstdint>
+
 #include "lib/util/game/Scene.h"
+#include "lib/util/game/2d/collider/SpatialHash.h"
+#include "lib/util/collection/ArrayList.h"
 
 namespace Util {
 namespace Game {
@@ -64,6 +68,11 @@ public:
     void checkCollisions() override;
 
     virtual void initializeBackground(Graphics &graphics) = 0;
+
+private:
+
+    SpatialHash spatialHash;
+    ArrayList<uint32_t> collisionCandidates;
 };
 
 }
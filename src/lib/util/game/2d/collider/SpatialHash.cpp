@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SpatialHash.h"
+
+#include "lib/util/game/2d/collider/RectangleCollider.h"
+#include "lib/util/math/Vector3D.h"
+
+namespace Util::Game::D2 {
+
+SpatialHash::~SpatialHash() {
+    delete[] buckets;
+    delete[] entries;
+    delete[] stamps;
+}
+
+void SpatialHash::reset(double cellSize, uint32_t idCount) {
+    SpatialHash::cellSize = cellSize;
+    entryCount = 0;
+    oversized.clear();
+
+    // Keep the load factor below 0.5, assuming that most colliders occupy up to 4 cells
+    uint32_t requiredBuckets = 16;
+    while (requiredBuckets < idCount * 8) {
+        requiredBuckets *= 2;
+    }
+
+    if (requiredBuckets > bucketCount) {
+        delete[] buckets;
+        buckets = new uint32_t[requiredBuckets];
+        bucketCount = requiredBuckets;
+    }
+
+    for (uint32_t i = 0; i < bucketCount; i++) {
+        buckets[i] = INVALID_ENTRY;
+    }
+
+    if (idCount > stampCount) {
+        delete[] stamps;
+        stamps = new uint32_t[idCount];
+        stampCount = idCount;
+
+        for (uint32_t i = 0; i < stampCount; i++) {
+            stamps[i] = 0;
+        }
+
+        currentStamp = 0;
+    }
+}
+
+void SpatialHash::insert(uint32_t id, const RectangleCollider &collider) {
+    const auto range = getCellRange(collider);
+    if (range.getCellCount() > MAX_CELLS_PER_COLLIDER) {
+        oversized.add(id);
+        return;
+    }
+
+    if (entryCount + range.getCellCount() > entryCapacity) {
+        auto newCapacity = entryCapacity == 0 ? 64 : entryCapacity * 2;
+        while (newCapacity < entryCount + range.getCellCount()) {
+            newCapacity *= 2;
+        }
+
+        auto *newEntries = new Entry[newCapacity];
+        for (uint32_t i = 0; i < entryCount; i++) {
+            newEntries[i] = entries[i];
+        }
+
+        delete[] entries;
+        entries = newEntries;
+        entryCapacity = newCapacity;
+    }
+
+    for (int32_t y = range.startY; y <= range.endY; y++) {
+        for (int32_t x = range.startX; x <= range.endX; x++) {
+            const auto bucket = hash(x, y);
+            entries[entryCount] = Entry{x, y, id, buckets[bucket]};
+            buckets[bucket] = entryCount++;
+        }
+    }
+}
+
+void SpatialHash::query(const RectangleCollider &collider, ArrayList<uint32_t> &result) {
+    result.clear();
+
+    // Start a new query; Stamps need to be reset, when the counter wraps around
+    if (++currentStamp == 0) {
+        for (uint32_t i = 0; i < stampCount; i++) {
+            stamps[i] = 0;
+        }
+
+        currentStamp = 1;
+    }
+
+    for (auto id : oversized) {
+        addResult(id, result);
+    }
+
+    const auto range = getCellRange(collider);
+    if (range.getCellCount() > MAX_CELLS_PER_COLLIDER) {
+        // Walking through all cells would be more expensive than just returning every collider
+        for (uint32_t i = 0; i < entryCount; i++) {
+            addResult(entries[i].id, result);
+        }
+
+        return;
+    }
+
+    for (int32_t y = range.startY; y <= range.endY; y++) {
+        for (int32_t x = range.startX; x <= range.endX; x++) {
+            for (auto index = buckets[hash(x, y)]; index != INVALID_ENTRY; index = entries[index].next) {
+                const auto &entry = entries[index];
+                if (entry.cellX == x && entry.cellY == y) {
+                    addResult(entry.id, result);
+                }
+            }
+        }
+    }
+}
+
+SpatialHash::CellRange SpatialHash::getCellRange(const RectangleCollider &collider) const {
+    const auto &position = collider.getPosition();
+    return CellRange{getCell(position.getX()), getCell(position.getY()),
+                     getCell(position.getX() + collider.getWidth()), getCell(position.getY() + collider.getHeight())};
+}
+
+int32_t SpatialHash::getCell(double coordinate) const {
+    const auto scaled = coordinate / cellSize;
+    auto cell = static_cast<int32_t>(scaled);
+
+    // Casting rounds towards zero, but negative coordinates need to be rounded down
+    return scaled < cell ? cell - 1 : cell;
+}
+
+uint32_t SpatialHash::hash(int32_t cellX, int32_t cellY) const {
+    return ((static_cast<uint32_t>(cellX) * 73856093) ^ (static_cast<uint32_t>(cellY) * 19349663)) & (bucketCount - 1);
+}
+
+void SpatialHash::addResult(uint32_t id, ArrayList<uint32_t> &result) {
+    if (stamps[id] == currentStamp) {
+        return;
+    }
+
+    stamps[id] = currentStamp;
+
+    // Insert sorted; Results are usually very short, so that insertion sort is sufficient
+    auto index = result.size();
+    while (index > 0 && result.get(index - 1) > id) {
+        index--;
+    }
+
+    result.add(index, id);
+}
+
+}
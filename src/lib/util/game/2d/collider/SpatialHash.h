@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SPATIALHASH_H
+#define HHUOS_SPATIALHASH_H
+
+#include <cstdint>
+
+#include "lib/util/collection/ArrayList.h"
+
+namespace Util {
+namespace Game {
+namespace D2 {
+class RectangleCollider;
+}  // namespace D2
+}  // namespace Game
+}  // namespace Util
+
+namespace Util::Game::D2 {
+
+/**
+ * Broadphase for collision detection. Colliders are sorted into a uniform grid of square cells,
+ * which is stored in a hash table, so that the world does not need to be bounded.
+ * A query only returns colliders sharing at least one cell with the queried bounds,
+ * which reduces the number of exact collision checks from quadratic to roughly linear in the number of colliders.
+ */
+class SpatialHash {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    SpatialHash() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    SpatialHash(const SpatialHash &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SpatialHash &operator=(const SpatialHash &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SpatialHash();
+
+    /**
+     * Remove all colliders and prepare the grid for a new set of colliders.
+     * Memory is kept between calls, so that rebuilding the grid every frame does not allocate.
+     *
+     * @param cellSize The edge length of a cell (should be larger than most colliders)
+     * @param idCount The upper bound (exclusive) for ids, passed to insert()
+     */
+    void reset(double cellSize, uint32_t idCount);
+
+    void insert(uint32_t id, const RectangleCollider &collider);
+
+    /**
+     * Collect the ids of all colliders, which share a cell with the given collider.
+     * Each id is returned only once and ids are sorted in ascending order, so that the result does not depend on the grid layout.
+     *
+     * @param collider The collider to query
+     * @param result The list to store the ids in (is cleared before)
+     */
+    void query(const RectangleCollider &collider, ArrayList<uint32_t> &result);
+
+    static const constexpr uint32_t MAX_CELLS_PER_COLLIDER = 16;
+
+private:
+
+    struct Entry {
+        int32_t cellX;
+        int32_t cellY;
+        uint32_t id;
+        uint32_t next;
+    };
+
+    struct CellRange {
+        int32_t startX;
+        int32_t startY;
+        int32_t endX;
+        int32_t endY;
+
+        [[nodiscard]] uint32_t getCellCount() const {
+            return static_cast<uint32_t>(endX - startX + 1) * static_cast<uint32_t>(endY - startY + 1);
+        }
+    };
+
+    [[nodiscard]] CellRange getCellRange(const RectangleCollider &collider) const;
+
+    [[nodiscard]] int32_t getCell(double coordinate) const;
+
+    [[nodiscard]] uint32_t hash(int32_t cellX, int32_t cellY) const;
+
+    void addResult(uint32_t id, ArrayList<uint32_t> &result);
+
+    double cellSize = 1;
+
+    uint32_t *buckets = nullptr;
+    uint32_t bucketCount = 0;
+
+    Entry *entries = nullptr;
+    uint32_t entryCount = 0;
+    uint32_t entryCapacity = 0;
+
+    // Colliders spanning too many cells are not sorted into the grid, but returned by every query
+    ArrayList<uint32_t> oversized;
+
+    // Used to detect duplicates in a query result; An id has been visited, if its stamp equals the current query stamp
+    uint32_t *stamps = nullptr;
+    uint32_t stampCount = 0;
+    uint32_t currentStamp = 0;
+
+    static const constexpr uint32_t INVALID_ENTRY = 0xffffffff;
+};
+
+}
+
+#endif
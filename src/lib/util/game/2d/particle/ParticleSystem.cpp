@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ParticleSystem.h"
+
+#include "lib/util/game/Graphics.h"
+#include "lib/util/hardware/CpuId.h"
+
+namespace Util {
+namespace Game {
+namespace D2 {
+class CollisionEvent;
+class TranslationEvent;
+}  // namespace D2
+}  // namespace Game
+}  // namespace Util
+
+namespace Util::Game::D2 {
+
+ParticleSystem::ParticleSystem(uint32_t tag, const Math::Vector2D &position, uint32_t capacity) : Entity(tag, position), capacity(capacity),
+        positionsX(new float[capacity]), positionsY(new float[capacity]), velocitiesX(new float[capacity]), velocitiesY(new float[capacity]),
+        timesToLive(new float[capacity]), lifetimes(new float[capacity]), colors(new uint32_t[capacity]) {
+    useSse = (Hardware::CpuId::getCpuFeatureBits() & Hardware::CpuId::SSE) != 0;
+}
+
+ParticleSystem::~ParticleSystem() {
+    delete[] positionsX;
+    delete[] positionsY;
+    delete[] velocitiesX;
+    delete[] velocitiesY;
+    delete[] timesToLive;
+    delete[] lifetimes;
+    delete[] colors;
+}
+
+void ParticleSystem::initialize() {}
+
+void ParticleSystem::onUpdate(double delta) {
+    if (activeParticles == 0) {
+        return;
+    }
+
+    integrate(static_cast<float>(delta));
+    removeDeadParticles(static_cast<float>(delta));
+}
+
+void ParticleSystem::draw(Graphics &graphics) {
+    graphics.drawParticles2D(positionsX, positionsY, colors, activeParticles, particleSize);
+}
+
+void ParticleSystem::onTranslationEvent(TranslationEvent &event) {}
+
+void ParticleSystem::onCollisionEvent(CollisionEvent &event) {}
+
+uint32_t ParticleSystem::emit(const Math::Vector2D &position, uint32_t count) {
+    const auto emitCount = count > capacity - activeParticles ? capacity - activeParticles : count;
+    const auto color = particleColor.getRGB32();
+
+    for (uint32_t i = 0; i < emitCount; i++) {
+        const auto index = activeParticles++;
+        const auto angle = minAngle + random.nextRandomNumber() * (maxAngle - minAngle);
+        const auto speed = minSpeed + random.nextRandomNumber() * (maxSpeed - minSpeed);
+        const auto timeToLive = minTimeToLive + random.nextRandomNumber() * (maxTimeToLive - minTimeToLive);
+
+        positionsX[index] = static_cast<float>(position.getX());
+        positionsY[index] = static_cast<float>(position.getY());
+        velocitiesX[index] = static_cast<float>(Math::cosine(angle) * speed);
+        velocitiesY[index] = static_cast<float>(Math::sine(angle) * speed);
+        timesToLive[index] = static_cast<float>(timeToLive);
+        lifetimes[index] = static_cast<float>(timeToLive);
+        colors[index] = color;
+    }
+
+    return emitCount;
+}
+
+void ParticleSystem::integrate(float delta) {
+    const auto accelerationX = static_cast<float>(acceleration.getX());
+    const auto accelerationY = static_cast<float>(acceleration.getY());
+    uint32_t start = 0;
+
+    if (useSse) {
+        // SSE processes blocks of four particles, the remainder is integrated by the scalar loop below
+        integrateSse(positionsX, velocitiesX, activeParticles, accelerationX, delta);
+        integrateSse(positionsY, velocitiesY, activeParticles, accelerationY, delta);
+        start = activeParticles - (activeParticles % 4);
+    }
+
+    integrateScalar(positionsX, velocitiesX, start, activeParticles, accelerationX, delta);
+    integrateScalar(positionsY, velocitiesY, start, activeParticles, accelerationY, delta);
+}
+
+void ParticleSystem::removeDeadParticles(float delta) {
+    const auto baseAlpha = static_cast<float>(particleColor.getAlpha());
+
+    for (uint32_t i = 0; i < activeParticles;) {
+        timesToLive[i] -= delta;
+        if (timesToLive[i] <= 0 || (floorEnabled && positionsY[i] < floor)) {
+            // The last particle is moved into this slot and must be checked in the next iteration
+            removeParticle(i);
+            continue;
+        }
+
+        if (fadeOut) {
+            const auto alpha = static_cast<uint32_t>(baseAlpha * timesToLive[i] / lifetimes[i]);
+            colors[i] = (colors[i] & 0x00ffffff) | (alpha << 24);
+        }
+
+        i++;
+    }
+}
+
+void ParticleSystem::removeParticle(uint32_t index) {
+    const auto last = --activeParticles;
+    positionsX[index] = positionsX[last];
+    positionsY[index] = positionsY[last];
+    velocitiesX[index] = velocitiesX[last];
+    velocitiesY[index] = velocitiesY[last];
+    timesToLive[index] = timesToLive[last];
+    lifetimes[index] = lifetimes[last];
+    colors[index] = colors[last];
+}
+
+// Enable SSE for this function only, so that the compiler accepts the xmm registers in the clobber list
+__attribute__((target("sse")))
+void ParticleSystem::integrateSse(float *positions, float *velocities, uint32_t count, float acceleration, float delta) {
+    // Constant factors for four particles: velocity change, followed by time step
+    const float factors[8] = { acceleration * delta, acceleration * delta, acceleration * delta, acceleration * delta, delta, delta, delta, delta };
+
+    // Semi-implicit euler integration: velocity += acceleration * delta; position += velocity * delta
+    for (uint32_t i = 0; i + 4 <= count; i += 4) {
+        asm volatile (
+                "movups (%2), %%xmm2;"
+                "movups 16(%2), %%xmm3;"
+                "movups (%1), %%xmm1;"
+                "addps %%xmm2, %%xmm1;"
+                "movups %%xmm1, (%1);"
+                "mulps %%xmm3, %%xmm1;"
+                "movups (%0), %%xmm0;"
+                "addps %%xmm1, %%xmm0;"
+                "movups %%xmm0, (%0);"
+                : :
+                "r"(positions + i),
+                "r"(velocities + i),
+                "r"(factors)
+                : "xmm0", "xmm1", "xmm2", "xmm3", "memory"
+                );
+    }
+}
+
+void ParticleSystem::integrateScalar(float *positions, float *velocities, uint32_t start, uint32_t end, float acceleration, float delta) {
+    const auto velocityChange = acceleration * delta;
+
+    for (uint32_t i = start; i < end; i++) {
+        velocities[i] += velocityChange;
+        positions[i] += velocities[i] * delta;
+    }
+}
+
+void ParticleSystem::setAngleRange(double minAngle, double maxAngle) {
+    ParticleSystem::minAngle = minAngle;
+    ParticleSystem::maxAngle = maxAngle;
+}
+
+void ParticleSystem::setSpeedRange(double minSpeed, double maxSpeed) {
+    ParticleSystem::minSpeed = minSpeed;
+    ParticleSystem::maxSpeed = maxSpeed;
+}
+
+void ParticleSystem::setTimeToLiveRange(double minTimeToLive, double maxTimeToLive) {
+    ParticleSystem::minTimeToLive = minTimeToLive;
+    ParticleSystem::maxTimeToLive = maxTimeToLive;
+}
+
+void ParticleSystem::setAcceleration(const Math::Vector2D &acceleration) {
+    ParticleSystem::acceleration = acceleration;
+}
+
+void ParticleSystem::setFloor(double floor) {
+    ParticleSystem::floor = static_cast<float>(floor);
+    floorEnabled = true;
+}
+
+void ParticleSystem::setParticleSize(double size) {
+    particleSize = size;
+}
+
+void ParticleSystem::setParticleColor(const Graphic::Color &color) {
+    particleColor = color;
+}
+
+void ParticleSystem::setFadeOut(bool fadeOut) {
+    ParticleSystem::fadeOut = fadeOut;
+}
+
+uint32_t ParticleSystem::getActiveParticles() const {
+    return activeParticles;
+}
+
+uint32_t ParticleSystem::getCapacity() const {
+    return capacity;
+}
+
+}
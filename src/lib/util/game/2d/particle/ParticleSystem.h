@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PARTICLESYSTEM_H
+#define HHUOS_PARTICLESYSTEM_H
+
+#include <cstdint>
+
+#include "lib/util/game/2d/Entity.h"
+#include "lib/util/math/Random.h"
+#include "lib/util/math/Math.h"
+#include "lib/util/math/Vector2D.h"
+#include "lib/util/graphic/Color.h"
+
+namespace Util {
+namespace Game {
+class Graphics;
+namespace D2 {
+class CollisionEvent;
+class TranslationEvent;
+}  // namespace D2
+}  // namespace Game
+}  // namespace Util
+
+namespace Util::Game::D2 {
+
+/**
+ * Simulates and draws a large number of simple particles, without creating an entity for each of them.
+ * All particle attributes are stored in separate contiguous arrays (structure of arrays), so that the update loop
+ * can integrate four particles at once with SSE (if supported by the CPU) and all particles can be drawn in a single pass.
+ * Dead particles are replaced by the last active particle, keeping the arrays dense.
+ * Particles do not collide with other entities, but can be removed once they fall below a configurable floor.
+ */
+class ParticleSystem : public Entity {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param tag The entity tag
+     * @param position The position of the particle system (only used for its own translation, particles are emitted at arbitrary positions)
+     * @param capacity The maximum amount of simultaneously active particles
+     */
+    ParticleSystem(uint32_t tag, const Math::Vector2D &position, uint32_t capacity);
+
+    /**
+     * Copy Constructor.
+     */
+    ParticleSystem(const ParticleSystem &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ParticleSystem &operator=(const ParticleSystem &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ParticleSystem() override;
+
+    void initialize() override;
+
+    void onUpdate(double delta) override;
+
+    void draw(Graphics &graphics) override;
+
+    void onTranslationEvent(TranslationEvent &event) override;
+
+    void onCollisionEvent(CollisionEvent &event) override;
+
+    /**
+     * Emit new particles at a given position. Direction, speed and lifetime are chosen randomly within the configured ranges.
+     * Particles exceeding the capacity are discarded.
+     *
+     * @return The amount of actually emitted particles
+     */
+    uint32_t emit(const Math::Vector2D &position, uint32_t count);
+
+    void setAngleRange(double minAngle, double maxAngle);
+
+    void setSpeedRange(double minSpeed, double maxSpeed);
+
+    void setTimeToLiveRange(double minTimeToLive, double maxTimeToLive);
+
+    void setAcceleration(const Math::Vector2D &acceleration);
+
+    void setFloor(double floor);
+
+    void setParticleSize(double size);
+
+    void setParticleColor(const Graphic::Color &color);
+
+    void setFadeOut(bool fadeOut);
+
+    [[nodiscard]] uint32_t getActiveParticles() const;
+
+    [[nodiscard]] uint32_t getCapacity() const;
+
+private:
+
+    void integrate(float delta);
+
+    void removeDeadParticles(float delta);
+
+    void removeParticle(uint32_t index);
+
+    static void integrateSse(float *positions, float *velocities, uint32_t count, float acceleration, float delta);
+
+    static void integrateScalar(float *positions, float *velocities, uint32_t start, uint32_t end, float acceleration, float delta);
+
+    Math::Random random;
+
+    const uint32_t capacity;
+    uint32_t activeParticles = 0;
+    bool useSse = false;
+
+    float *positionsX;
+    float *positionsY;
+    float *velocitiesX;
+    float *velocitiesY;
+    float *timesToLive;
+    float *lifetimes;
+    uint32_t *colors;
+
+    double minAngle = 0;
+    double maxAngle = 2 * Math::PI;
+    double minSpeed = 1;
+    double maxSpeed = 1;
+    double minTimeToLive = 1;
+    double maxTimeToLive = 1;
+    Math::Vector2D acceleration{};
+    bool floorEnabled = false;
+    float floor = 0;
+    double particleSize = 0.005;
+    Graphic::Color particleColor = Graphic::Color(255, 255, 255);
+    bool fadeOut = false;
+};
+
+}
+
+#endif
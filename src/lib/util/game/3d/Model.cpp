@@ -23,16 +23,14 @@
 
 #include "Model.h"
 
-#include "lib/util/game/GameManager.h"
 #include "lib/util/math/Vector2D.h"
 #include "lib/util/math/Math.h"
+#include "lib/util/math/Matrix4x4.h"
 #include "lib/util/game/ResourceManager.h"
 #include "lib/util/game/3d/Entity.h"
 #include "lib/util/game/3d/ObjectFile.h"
 #include "lib/util/game/3d/collider/SphereCollider.h"
-#include "lib/util/game/Camera.h"
 #include "lib/util/game/Graphics.h"
-#include "lib/util/game/Scene.h"
 
 namespace Util::Game::D3 {
 
@@ -41,45 +39,24 @@ Model::Model(uint32_t tag, const String &modelPath, const Math::Vector3D &positi
 Model::Model(uint32_t tag, const String &modelPath, const Math::Vector3D &position, const Math::Vector3D &rotation, const Math::Vector3D &scale, const Graphic::Color &color) : Entity(tag, position, rotation, scale, SphereCollider(position, Math::max(scale.getX(), scale.getY(), scale.getZ()))), modelPath(modelPath), color(color) {}
 
 void Model::initialize() {
-    if (!ResourceManager::hasObjectFile(modelPath)) {
-        ResourceManager::addObjectFile(modelPath, ObjectFile::open(modelPath));
-    }
-
-    objectFile = ResourceManager::getObjectFile(modelPath);
+    objectFile = ResourceManager::loadObjectFile(modelPath);
     transformedBuffer = Util::Array<Math::Vector3D>(objectFile->getVertices().length());
     calculateTransformedVertices();
 }
 
 void Model::calculateTransformedVertices() {
-    const auto &vertices = objectFile->getVertices();
-    for (uint32_t i = 0; i < vertices.length(); i++) {
-        auto vertex = vertices[i];
-
-        vertex = vertex.scale(getScale());
-        vertex = vertex.rotate(getRotation());
-        vertex = vertex + getPosition();
-
-        transformedBuffer[i] = vertex;
-    }
+    const auto modelMatrix = Math::Matrix4x4::translation(getPosition()) * Math::Matrix4x4::rotation(getRotation()) * Math::Matrix4x4::scaling(getScale());
+    modelMatrix.transform(objectFile->getVertices(), transformedBuffer);
 }
 
 void Model::draw(Graphics &graphics) {
-    auto &camera = Util::Game::GameManager::getCurrentScene().getCamera();
-    auto minXProjection = Util::Game::Graphics::projectPoint(getPosition() + Util::Math::Vector3D(-getCollider().getRadius(), 0, 0), camera.getPosition(), camera.getRotation());
-    auto maxXProjection = Util::Game::Graphics::projectPoint(getPosition() + Util::Math::Vector3D(getCollider().getRadius(), 0, 0), camera.getPosition(), camera.getRotation());
-    auto minYProjection = Util::Game::Graphics::projectPoint(getPosition() + Util::Math::Vector3D(0, -getCollider().getRadius(), 0), camera.getPosition(), camera.getRotation());
-    auto maxYProjection = Util::Game::Graphics::projectPoint(getPosition() + Util::Math::Vector3D(0, getCollider().getRadius(), 0), camera.getPosition(), camera.getRotation());
-    auto minZProjection = Util::Game::Graphics::projectPoint(getPosition() + Util::Math::Vector3D(0, 0, -getCollider().getRadius()), camera.getPosition(), camera.getRotation());
-    auto maxZProjection = Util::Game::Graphics::projectPoint(getPosition() + Util::Math::Vector3D(0, 0, getCollider().getRadius()), camera.getPosition(), camera.getRotation());
-
-    if (((minXProjection.getX() >= -1 && minXProjection.getX() <= 1) && (minXProjection.getY() >= -1 && minXProjection.getY() <= 1)) ||
-            ((maxXProjection.getX() >= -1 && maxXProjection.getX() <= 1) && (maxXProjection.getY() >= -1 && maxXProjection.getY() <= 1)) ||
-            ((minYProjection.getX() >= -1 && minYProjection.getX() <= 1) && (minYProjection.getY() >= -1 && minYProjection.getY() <= 1)) ||
-            ((maxYProjection.getX() >= -1 && maxYProjection.getX() <= 1) && (maxYProjection.getY() >= -1 && maxYProjection.getY() <= 1)) ||
-            ((minZProjection.getX() >= -1 && minZProjection.getX() <= 1) && (minZProjection.getY() >= -1 && minZProjection.getY() <= 1)) ||
-            ((maxZProjection.getX() >= -1 && maxZProjection.getX() <= 1) && (maxZProjection.getY() >= -1 && maxZProjection.getY() <= 1))) {
+    if (graphics.isSphereVisible(getPosition(), getCollider().getRadius())) {
         graphics.setColor(color);
-        graphics.drawModel(transformedBuffer, objectFile->getEdges());
+        if (filled) {
+            graphics.fillModel(transformedBuffer, objectFile->getTriangles());
+        } else {
+            graphics.drawModel(transformedBuffer, objectFile->getEdges());
+        }
     }
 }
 
@@ -87,4 +64,8 @@ void Model::onTransformChange() {
     calculateTransformedVertices();
 }
 
+void Model::setFilled(bool filled) {
+    Model::filled = filled;
+}
+
 }
\ No newline at end of file
@@ -78,6 +78,11 @@ public:
 
     void onTransformChange() override;
 
+    /**
+     * Draw the model as filled, flat shaded triangles instead of a wireframe.
+     */
+    void setFilled(bool filled);
+
 private:
 
     void calculateTransformedVertices();
@@ -86,6 +91,7 @@ private:
     const Graphic::Color color = Graphic::Colors::GREEN;
 
     ObjectFile *objectFile = nullptr;
+    bool filled = false;
     Array<Math::Vector3D> transformedBuffer = Array<Math::Vector3D>(0);
 };
 
@@ -25,68 +25,311 @@
 
 #include <cstdint>
 
+#include "lib/util/base/Exception.h"
+#include "lib/util/io/file/File.h"
 #include "lib/util/io/stream/FileInputStream.h"
-#include "lib/util/io/stream/BufferedInputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/math/Math.h"
-#include "lib/util/collection/Iterator.h"
 
 namespace Util::Game::D3 {
 
-ObjectFile::ObjectFile(const Array<Math::Vector3D> &vertices, const Array<Math::Vector2D> &edges) : vertices(vertices), edges(edges) {}
+static const char* skipWhitespace(const char *current, const char *end) {
+    while (current < end && (*current == ' ' || *current == '\t' || *current == '\r')) {
+        current++;
+    }
+
+    return current;
+}
+
+static const char* skipLine(const char *current, const char *end) {
+    while (current < end && *current != '\n') {
+        current++;
+    }
+
+    return current < end ? current + 1 : end;
+}
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static const char* parseNumber(const char *current, const char *end, double &value) {
+    bool negative = false;
+    if (current < end && (*current == '-' || *current == '+')) {
+        negative = *current == '-';
+        current++;
+    }
+
+    value = 0;
+    while (current < end && isDigit(*current)) {
+        value = value * 10 + (*current++ - '0');
+    }
+
+    if (current < end && *current == '.') {
+        double factor = 0.1;
+        for (current++; current < end && isDigit(*current); current++) {
+            value += (*current - '0') * factor;
+            factor /= 10;
+        }
+    }
+
+    if (current < end && (*current == 'e' || *current == 'E')) {
+        double exponent;
+        current = parseNumber(current + 1, end, exponent);
+        value = exponent < 0 ? value / Math::pow(10, static_cast<int>(-exponent)) : value * Math::pow(10, static_cast<int>(exponent));
+    }
+
+    value = negative ? -value : value;
+    return current;
+}
+
+/**
+ * Parse a face vertex ("v", "v/vt", "v//vn" or "v/vt/vn") and return its zero-based vertex index.
+ * Negative indices are relative to the amount of vertices read so far.
+ */
+static const char* parseFaceVertex(const char *current, const char *end, uint32_t vertexCount, uint32_t &index) {
+    double value;
+    current = parseNumber(current, end, value);
+    auto parsedIndex = static_cast<int32_t>(value);
+    index = parsedIndex < 0 ? vertexCount + parsedIndex : parsedIndex - 1;
+
+    // Texture coordinate and normal indices are not needed
+    while (current < end && *current != ' ' && *current != '\t' && *current != '\r' && *current != '\n') {
+        current++;
+    }
+
+    return current;
+}
+
+/**
+ * Insert an undirected edge into an open addressing hash set, resizing it if it gets too full.
+ *
+ * @return true, if the edge has not been part of the set before
+ */
+static bool addUniqueEdge(uint64_t *&table, uint32_t &tableSize, uint32_t &edgeCount, uint32_t point1, uint32_t point2) {
+    static const constexpr uint64_t EMPTY = UINT64_MAX;
+
+    if ((edgeCount + 1) * 2 > tableSize) {
+        auto *oldTable = table;
+        auto oldSize = tableSize;
+        tableSize = tableSize == 0 ? 256 : tableSize * 2;
+        table = new uint64_t[tableSize];
+        for (uint32_t i = 0; i < tableSize; i++) {
+            table[i] = EMPTY;
+        }
+
+        edgeCount = 0;
+        for (uint32_t i = 0; i < oldSize; i++) {
+            if (oldTable[i] != EMPTY) {
+                addUniqueEdge(table, tableSize, edgeCount, oldTable[i] >> 32, oldTable[i] & 0xffffffff);
+            }
+        }
+
+        delete[] oldTable;
+    }
+
+    const auto key = point1 < point2 ? (static_cast<uint64_t>(point1) << 32) | point2 : (static_cast<uint64_t>(point2) << 32) | point1;
+    auto slot = static_cast<uint32_t>((key * 0x9e3779b97f4a7c15) >> 32) & (tableSize - 1);
+    while (table[slot] != EMPTY) {
+        if (table[slot] == key) {
+            return false;
+        }
+
+        slot = (slot + 1) & (tableSize - 1);
+    }
+
+    table[slot] = key;
+    edgeCount++;
+    return true;
+}
+
+ObjectFile::ObjectFile(const Array<Math::Vector3D> &vertices, const Array<Math::Vector2D> &edges, const Array<uint32_t> &triangles) : vertices(vertices), edges(edges), triangles(triangles) {}
 
 ObjectFile* ObjectFile::open(const String &path) {
-    auto fileStream = Io::FileInputStream(path);
-    auto stream = Io::BufferedInputStream(fileStream);
+    auto file = Io::File(path);
+    if (!file.exists() || file.isDirectory()) {
+        Exception::throwException(Exception::INVALID_ARGUMENT, "ObjectFile: File not found!");
+    }
+
+    auto length = file.getLength();
+    auto *buffer = new uint8_t[length];
+    auto stream = Io::FileInputStream(file);
+    stream.read(buffer, 0, length);
+
+    auto *objectFile = length >= sizeof(MeshHeader) && reinterpret_cast<const MeshHeader*>(buffer)->magic == MESH_MAGIC ?
+            parseMesh(buffer, length) : parseObject(reinterpret_cast<const char*>(buffer), length);
+
+    delete[] buffer;
+    return objectFile;
+}
+
+void ObjectFile::save(const String &path) const {
+    auto file = Io::File(path);
+    if (!file.exists() && !file.create(Io::File::REGULAR)) {
+        Exception::throwException(Exception::INVALID_ARGUMENT, "ObjectFile: Unable to create file!");
+    }
+
+    const auto triangleCount = triangles.length() / 3;
+    const auto length = sizeof(MeshHeader) + vertices.length() * 3 * sizeof(float) + edges.length() * 2 * sizeof(uint32_t) + triangleCount * 3 * sizeof(uint32_t);
+    auto *buffer = new uint8_t[length];
+
+    auto &header = *reinterpret_cast<MeshHeader*>(buffer);
+    header.magic = MESH_MAGIC;
+    header.version = MESH_VERSION;
+    header.headerSize = sizeof(MeshHeader);
+    header.vertexCount = vertices.length();
+    header.edgeCount = edges.length();
+    header.triangleCount = triangleCount;
+
+    auto *vertexData = reinterpret_cast<float*>(buffer + sizeof(MeshHeader));
+    for (uint32_t i = 0; i < vertices.length(); i++) {
+        vertexData[i * 3] = static_cast<float>(vertices[i].getX());
+        vertexData[i * 3 + 1] = static_cast<float>(vertices[i].getY());
+        vertexData[i * 3 + 2] = static_cast<float>(vertices[i].getZ());
+    }
+
+    auto *edgeData = reinterpret_cast<uint32_t*>(vertexData + vertices.length() * 3);
+    for (uint32_t i = 0; i < edges.length(); i++) {
+        edgeData[i * 2] = static_cast<uint32_t>(edges[i].getX());
+        edgeData[i * 2 + 1] = static_cast<uint32_t>(edges[i].getY());
+    }
+
+    auto *triangleData = edgeData + edges.length() * 2;
+    for (uint32_t i = 0; i < triangleCount * 3; i++) {
+        triangleData[i] = triangles[i];
+    }
+
+    auto stream = Io::FileOutputStream(file);
+    stream.write(buffer, 0, length);
+    delete[] buffer;
+}
+
+ObjectFile* ObjectFile::parseObject(const char *data, uint32_t length) {
+    const auto *current = data;
+    const auto *end = data + length;
     auto vertexList = ArrayList<Math::Vector3D>();
     auto edgeList = ArrayList<Math::Vector2D>();
-    bool endOfFile = false;
-
-    auto currentLine = stream.readLine(endOfFile);
-    while (!endOfFile) {
-        auto lineSplit = currentLine.substring(2).split(" ");
-
-        if (currentLine.beginsWith("v ")) {
-            auto vertex = Math::Vector3D(String::parseDouble(lineSplit[0]), String::parseDouble(lineSplit[1]), String::parseDouble(lineSplit[2]));
-            vertexList.add(vertex);
-        } else if (currentLine.beginsWith("f ")) {
-            for (uint32_t i = 0; i < lineSplit.length() - 1; i++) {
-                auto point1 = String::parseInt(lineSplit[i].split("/")[0]) - 1;
-                auto point2 = String::parseInt(lineSplit[i + 1].split("/")[0]) - 1;
-                auto edge = Util::Math::Vector2D(point1, point2);
-
-                if (!edgeList.contains(Math::Vector2D(point1, point2)) && !edgeList.contains(Math::Vector2D(point2, point1))) {
-                    edgeList.add(edge);
-                }
+    auto triangleList = ArrayList<uint32_t>();
+    auto faceIndices = ArrayList<uint32_t>();
+
+    uint64_t *edgeTable = nullptr;
+    uint32_t edgeTableSize = 0;
+    uint32_t edgeCount = 0;
+
+    while (current < end) {
+        current = skipWhitespace(current, end);
+        if (end - current < 2 || current[1] != ' ' || (current[0] != 'v' && current[0] != 'f')) {
+            // Comments, empty lines and unsupported statements (e.g. normals or texture coordinates)
+            current = skipLine(current, end);
+            continue;
+        }
+
+        if (current[0] == 'v') {
+            double coordinates[3]{};
+            for (auto &coordinate : coordinates) {
+                current = parseNumber(skipWhitespace(current + 1, end), end, coordinate);
             }
 
-            // Add connection from last vertex to first vertex
-            auto point1 = String::parseInt(lineSplit[lineSplit.length() - 1].split("/")[0]) - 1;
-            auto point2 = String::parseInt(lineSplit[0].split("/")[0]) - 1;
-            auto edge = Util::Math::Vector2D(point1, point2);
+            vertexList.add(Math::Vector3D(coordinates[0], coordinates[1], coordinates[2]));
+        } else {
+            faceIndices.clear();
+            current = skipWhitespace(current + 1, end);
+            while (current < end && *current != '\n') {
+                uint32_t index;
+                current = skipWhitespace(parseFaceVertex(current, end, vertexList.size(), index), end);
+                faceIndices.add(index);
+            }
+
+            // Connect each vertex with its successor and the last vertex with the first one
+            for (uint32_t i = 0; i < faceIndices.size(); i++) {
+                auto point1 = faceIndices.get(i);
+                auto point2 = faceIndices.get((i + 1) % faceIndices.size());
+                if (addUniqueEdge(edgeTable, edgeTableSize, edgeCount, point1, point2)) {
+                    edgeList.add(Math::Vector2D(point1, point2));
+                }
+            }
 
-            if (!edgeList.contains(edge)) {
-                edgeList.add(edge);
+            // Split polygon into a triangle fan around its first vertex
+            for (uint32_t i = 1; i + 1 < faceIndices.size(); i++) {
+                triangleList.add(faceIndices.get(0));
+                triangleList.add(faceIndices.get(i));
+                triangleList.add(faceIndices.get(i + 1));
             }
         }
 
-        currentLine = stream.readLine(endOfFile);
+        current = skipLine(current, end);
     }
 
+    delete[] edgeTable;
+
     // Normalize model size
     double maxCoordinate = 0;
     for (const auto &vertex : vertexList) {
-        if (Math::absolute(vertex.getX()) > maxCoordinate) maxCoordinate = vertex.getX();
-        if (Math::absolute(vertex.getY()) > maxCoordinate) maxCoordinate = vertex.getY();
-        if (Math::absolute(vertex.getZ()) > maxCoordinate) maxCoordinate = vertex.getZ();
+        if (Math::absolute(vertex.getX()) > maxCoordinate) maxCoordinate = Math::absolute(vertex.getX());
+        if (Math::absolute(vertex.getY()) > maxCoordinate) maxCoordinate = Math::absolute(vertex.getY());
+        if (Math::absolute(vertex.getZ()) > maxCoordinate) maxCoordinate = Math::absolute(vertex.getZ());
+    }
+
+    auto vertices = vertexList.toArray();
+    if (maxCoordinate > 0) {
+        for (auto &vertex : vertices) {
+            vertex = vertex / maxCoordinate;
+        }
+    }
+
+    return new ObjectFile(vertices, edgeList.toArray(), triangleList.toArray());
+}
+
+ObjectFile* ObjectFile::parseMesh(const uint8_t *data, uint32_t length) {
+    if (length < sizeof(MeshHeader)) {
+        Exception::throwException(Exception::OUT_OF_BOUNDS, "ObjectFile: Mesh file is truncated!");
+    }
+
+    const auto &header = *reinterpret_cast<const MeshHeader*>(data);
+    if (header.version != MESH_VERSION) {
+        Exception::throwException(Exception::UNSUPPORTED_OPERATION, "ObjectFile: Unsupported mesh version!");
+    }
+
+    if (header.headerSize < sizeof(MeshHeader) || header.headerSize > length) {
+        Exception::throwException(Exception::INVALID_ARGUMENT, "ObjectFile: Invalid mesh header size!");
+    }
+
+    // The counts are read from the file -> Calculate in 64 bits, so that crafted values cannot wrap around
+    const auto expectedLength = static_cast<uint64_t>(header.headerSize) + (static_cast<uint64_t>(header.vertexCount) * 3 +
+            static_cast<uint64_t>(header.edgeCount) * 2 + static_cast<uint64_t>(header.triangleCount) * 3) * sizeof(uint32_t);
+    if (length < expectedLength) {
+        Exception::throwException(Exception::OUT_OF_BOUNDS, "ObjectFile: Mesh file is truncated!");
     }
 
-    for (uint32_t i = 0; i < vertexList.size(); i++) {
-        auto vertex = vertexList.get(i);
-        vertexList.set(i, Math::Vector3D(vertex.getX() / maxCoordinate, vertex.getY() / maxCoordinate, vertex.getZ() / maxCoordinate));
+    const auto *vertexData = reinterpret_cast<const float*>(data + header.headerSize);
+    const auto *edgeData = reinterpret_cast<const uint32_t*>(vertexData + header.vertexCount * 3);
+    const auto *triangleData = edgeData + header.edgeCount * 2;
+
+    auto vertices = Array<Math::Vector3D>(header.vertexCount);
+    for (uint32_t i = 0; i < header.vertexCount; i++) {
+        vertices[i] = Math::Vector3D(vertexData[i * 3], vertexData[i * 3 + 1], vertexData[i * 3 + 2]);
+    }
+
+    auto edges = Array<Math::Vector2D>(header.edgeCount);
+    for (uint32_t i = 0; i < header.edgeCount; i++) {
+        if (edgeData[i * 2] >= header.vertexCount || edgeData[i * 2 + 1] >= header.vertexCount) {
+            Exception::throwException(Exception::OUT_OF_BOUNDS, "ObjectFile: Edge references invalid vertex!");
+        }
+
+        edges[i] = Math::Vector2D(edgeData[i * 2], edgeData[i * 2 + 1]);
+    }
+
+    auto triangles = Array<uint32_t>(header.triangleCount * 3);
+    for (uint32_t i = 0; i < header.triangleCount * 3; i++) {
+        if (triangleData[i] >= header.vertexCount) {
+            Exception::throwException(Exception::OUT_OF_BOUNDS, "ObjectFile: Triangle references invalid vertex!");
+        }
+
+        triangles[i] = triangleData[i];
     }
 
-    return new ObjectFile(vertexList.toArray(), edgeList.toArray());
+    return new ObjectFile(vertices, edges, triangles);
 }
 
 const Array<Math::Vector3D>& ObjectFile::getVertices() const {
@@ -97,4 +340,8 @@ const Array<Math::Vector2D>& ObjectFile::getEdges() const {
     return edges;
 }
 
-}
\ No newline at end of file
+const Array<uint32_t>& ObjectFile::getTriangles() const {
+    return triangles;
+}
+
+}
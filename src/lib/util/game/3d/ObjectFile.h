@@ -24,6 +24,8 @@
 #ifndef HHUOS_OBJECTFILE_H
 #define HHUOS_OBJECTFILE_H
 
+#include <cstdint>
+
 #include "lib/util/base/String.h"
 #include "lib/util/math/Vector3D.h"
 #include "lib/util/collection/Array.h"
@@ -49,18 +51,53 @@ public:
      */
     ~ObjectFile() = default;
 
+    /**
+     * Load a model from a file, which is either a Wavefront OBJ file or a binary mesh file (detected by its magic number).
+     * Vertices of OBJ files are normalized to [-1, 1]. Binary mesh files are already normalized and loaded without any parsing.
+     */
     static ObjectFile* open(const String &path);
 
+    /**
+     * Store the model in the binary mesh format. Existing files are overwritten.
+     */
+    void save(const String &path) const;
+
     [[nodiscard]] const Array<Math::Vector3D>& getVertices() const;
 
     [[nodiscard]] const Array<Math::Vector2D>& getEdges() const;
 
-    ObjectFile(const Array<Math::Vector3D> &vertices, const Array<Math::Vector2D> &edges);
+    /**
+     * Get the model's faces, split into triangles. Each triangle consists of three consecutive vertex indices.
+     */
+    [[nodiscard]] const Array<uint32_t>& getTriangles() const;
+
+    ObjectFile(const Array<Math::Vector3D> &vertices, const Array<Math::Vector2D> &edges, const Array<uint32_t> &triangles);
 
 private:
 
+    /**
+     * Header of a binary mesh file. It is followed by 3 floats per vertex, 2 vertex indices (uint32_t) per edge
+     * and 3 vertex indices (uint32_t) per triangle.
+     */
+    struct MeshHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t vertexCount;
+        uint32_t edgeCount;
+        uint32_t triangleCount;
+    } __attribute__ ((packed));
+
+    static ObjectFile* parseObject(const char *data, uint32_t length);
+
+    static ObjectFile* parseMesh(const uint8_t *data, uint32_t length);
+
     Array<Math::Vector3D> vertices;
     Array<Math::Vector2D> edges;
+    Array<uint32_t> triangles;
+
+    static const constexpr uint32_t MESH_MAGIC = 0x4853454d; // "MESH"
+    static const constexpr uint16_t MESH_VERSION = 1;
 };
 
 }
@@ -50,6 +50,8 @@ void Scene::updateEntities(double delta) {
 
 void Scene::checkCollisions() {
     auto detectedCollisions = Util::ArrayList<Pair<Entity*, Entity*>>();
+    collisionCheckCounter = 0;
+    collisionCounter = 0;
 
     for (auto *entity : entities) {
         auto *entity3D = reinterpret_cast<D3::Entity*>(entity);
@@ -61,6 +63,7 @@ void Scene::checkCollisions() {
                     continue;
                 }
 
+                collisionCheckCounter++;
                 if (entity3D->getCollider().isColliding(otherEntity3D->getCollider())) {
                     auto event = CollisionEvent(*otherEntity3D);
                     auto otherEvent = CollisionEvent(*entity3D);
@@ -69,6 +72,7 @@ void Scene::checkCollisions() {
                     otherEntity3D->onCollisionEvent(otherEvent);
 
                     detectedCollisions.add(Util::Pair(entity3D, otherEntity3D));
+                    collisionCounter++;
                 }
             }
         }
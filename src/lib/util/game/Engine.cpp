@@ -143,6 +143,7 @@ void Engine::updateStatus() {
 
 void Engine::drawStatus() {
     auto charHeight = statisticsFont.getCharHeight() + 2;
+    const auto &scene = game.getCurrentScene();
     auto color = graphics.getColor();
 
     const auto &memoryManager = Util::System::getAddressSpaceHeader().memoryManager;
@@ -153,9 +154,10 @@ void Engine::drawStatus() {
     graphics.setColor(Graphic::Colors::WHITE);
     graphics.drawString(statisticsFont, Math::Vector2D(10, 10), String::format("FPS: %u", status.framesPerSecond));
     graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight), String::format("D: %ums | U: %ums | I: %ums", static_cast<uint32_t>(status.drawTime.toMilliseconds()), static_cast<uint32_t>(status.updateTime.toMilliseconds()), static_cast<uint32_t>(status.idleTime.toMilliseconds())));
-    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 2), String::format("Objects: %u | Edges: %u/%u", game.getCurrentScene().getObjectCount(), graphics.drawnEdgeCounter, graphics.edgeCounter));
-    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 3), String::format("Heap used: %u.%03u MB", heapUsedM, heapUsedK));
-    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 4), String::format("Resolution: %ux%u@%u", graphics.lfb.getResolutionX(), graphics.lfb.getResolutionY(), graphics.lfb.getColorDepth()));
+    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 2), String::format("Objects: %u | Edges: %u/%u | Triangles: %u/%u", scene.getObjectCount(), graphics.drawnEdgeCounter, graphics.edgeCounter, graphics.drawnTriangleCounter, graphics.triangleCounter));
+    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 3), String::format("Collisions: %u | Checks: %u", scene.collisionCounter, scene.collisionCheckCounter));
+    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 4), String::format("Heap used: %u.%03u MB", heapUsedM, heapUsedK));
+    graphics.drawString(statisticsFont, Math::Vector2D(10, 10 + charHeight * 5), String::format("Resolution: %ux%u@%u", graphics.lfb.getResolutionX(), graphics.lfb.getResolutionY(), graphics.lfb.getColorDepth()));
     graphics.setColor(color);
 }
 
@@ -28,6 +28,7 @@
 #include "Game.h"
 #include "lib/util/game/Camera.h"
 #include "lib/util/graphic/Image.h"
+#include "lib/util/graphic/Surface.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/game/Scene.h"
 #include "lib/util/math/Math.h"
@@ -35,11 +36,15 @@
 namespace Util::Game {
 
 Graphics::Graphics(const Graphic::LinearFrameBuffer &lfb, Game &game) :
-        game(game), lfb(lfb), pixelDrawer(Graphics::lfb), lineDrawer(pixelDrawer), stringDrawer(pixelDrawer),
+        game(game), lfb(lfb), pixelDrawer(Graphics::lfb), lineDrawer(pixelDrawer), surfaceDrawer(Graphics::lfb),
         transformation((lfb.getResolutionX() > lfb.getResolutionY() ? lfb.getResolutionY() : lfb.getResolutionX()) / 2),
         offsetX(transformation + (lfb.getResolutionX() > lfb.getResolutionY() ? (lfb.getResolutionX() - lfb.getResolutionY()) / 2 : 0)),
         offsetY(transformation + (lfb.getResolutionY() > lfb.getResolutionX() ? (lfb.getResolutionY() - lfb.getResolutionX()) / 2 : 0)) {}
 
+Graphics::~Graphics() {
+    delete rasterizer;
+}
+
 /***** Basic functions to draw directly on the screen ******/
 
 void Graphics::drawLine(const Math::Vector2D &from, const Math::Vector2D &to) const {
@@ -88,7 +93,7 @@ void Graphics::fillSquare(const Math::Vector2D &position, double size) const {
 }
 
 void Graphics::drawString(const Graphic::Font &font, const Math::Vector2D &position, const char *string) const {
-    stringDrawer.drawString(font, static_cast<uint16_t>(position.getX()), static_cast<uint16_t>(position.getY()), string, color, Util::Graphic::Colors::INVISIBLE);
+    glyphCache.drawString(lfb, font, static_cast<uint16_t>(position.getX()), static_cast<uint16_t>(position.getY()), string, color, Util::Graphic::Colors::INVISIBLE);
 }
 
 void Graphics::drawString(const Graphic::Font &font, const Math::Vector2D &position, const String &string) const {
@@ -142,7 +147,7 @@ void Graphics::fillRectangle2D(const Math::Vector2D &position, double width, dou
 }
 
 void Graphics::drawString2D(const Graphic::Font &font, const Math::Vector2D &position, const char *string) const {
-    stringDrawer.drawString(font, static_cast<int32_t>((position.getX() - cameraPosition.getX()) * transformation + offsetX), static_cast<int32_t>((-position.getY() + cameraPosition.getY()) * transformation + offsetY), string, color, Util::Graphic::Colors::INVISIBLE);
+    glyphCache.drawString(lfb, font, static_cast<int32_t>((position.getX() - cameraPosition.getX()) * transformation + offsetX), static_cast<int32_t>((-position.getY() + cameraPosition.getY()) * transformation + offsetY), string, color, Util::Graphic::Colors::INVISIBLE);
 }
 
 void Graphics::drawString2D(const Graphic::Font &font, const Math::Vector2D &position, const String &string) const {
@@ -164,50 +169,125 @@ void Graphics::drawImage2D(const Math::Vector2D &position, const Graphic::Image
     }
 }
 
+void Graphics::drawParticles2D(const float *positionsX, const float *positionsY, const uint32_t *colors, uint32_t count, double size) const {
+    const auto resolutionX = static_cast<int32_t>(lfb.getResolutionX());
+    const auto resolutionY = static_cast<int32_t>(lfb.getResolutionY());
+    const auto depth = lfb.getColorDepth();
+    const auto bytesPerPixel = (depth == 15 ? 16 : depth) / 8;
+    const auto pitch = lfb.getPitch();
+    auto *buffer = reinterpret_cast<uint8_t*>(lfb.getBuffer().get());
+
+    // All particles share the same size, so the world to screen transformation is reduced to one multiplication and addition per axis
+    const auto pixelSize = static_cast<int32_t>(size * transformation) > 0 ? static_cast<int32_t>(size * transformation) : 1;
+    const auto scale = static_cast<float>(transformation);
+    const auto translationX = static_cast<float>(offsetX - cameraPosition.getX() * transformation - pixelSize / 2.0);
+    const auto translationY = static_cast<float>(offsetY + cameraPosition.getY() * transformation - pixelSize / 2.0);
+
+    for (uint32_t i = 0; i < count; i++) {
+        const auto argb = colors[i];
+        const auto alpha = argb >> 24;
+        if (alpha == 0 || (bytesPerPixel != 4 && alpha < 128)) {
+            continue;
+        }
+
+        auto startX = static_cast<int32_t>(positionsX[i] * scale + translationX);
+        auto startY = static_cast<int32_t>(-positionsY[i] * scale + translationY);
+        auto endX = startX + pixelSize;
+        auto endY = startY + pixelSize;
+        if (endX <= 0 || endY <= 0 || startX >= resolutionX || startY >= resolutionY) {
+            continue;
+        }
+
+        startX = startX < 0 ? 0 : startX;
+        startY = startY < 0 ? 0 : startY;
+        endX = endX > resolutionX ? resolutionX : endX;
+        endY = endY > resolutionY ? resolutionY : endY;
+
+        auto *rowAddress = buffer + startY * pitch;
+        if (bytesPerPixel == 4) {
+            // Blend with 8-bit weights: target = (source * alpha + target * (256 - alpha)) / 256
+            const auto sourceWeight = alpha + 1;
+            const auto targetWeight = 256 - sourceWeight;
+            const auto sourceRedBlue = (argb & 0x00ff00ff) * sourceWeight;
+            const auto sourceGreen = (argb & 0x0000ff00) * sourceWeight;
+
+            for (int32_t y = startY; y < endY; y++) {
+                auto *row = reinterpret_cast<uint32_t*>(rowAddress);
+                for (int32_t x = startX; x < endX; x++) {
+                    const auto target = row[x];
+                    const auto redBlue = ((sourceRedBlue + (target & 0x00ff00ff) * targetWeight) >> 8) & 0x00ff00ff;
+                    const auto green = ((sourceGreen + (target & 0x0000ff00) * targetWeight) >> 8) & 0x0000ff00;
+                    row[x] = 0xff000000 | redBlue | green;
+                }
+
+                rowAddress += pitch;
+            }
+
+            continue;
+        }
+
+        const auto color = Graphic::Color::fromRGB32(argb);
+        const uint32_t nativeColor = depth == 24 ? color.getRGB24() : depth == 16 ? color.getRGB16() : color.getRGB15();
+        for (int32_t y = startY; y < endY; y++) {
+            for (int32_t x = startX; x < endX; x++) {
+                if (bytesPerPixel == 3) {
+                    rowAddress[x * 3] = nativeColor & 0xff;
+                    rowAddress[x * 3 + 1] = (nativeColor >> 8) & 0xff;
+                    rowAddress[x * 3 + 2] = (nativeColor >> 16) & 0xff;
+                } else {
+                    reinterpret_cast<uint16_t*>(rowAddress)[x] = static_cast<uint16_t>(nativeColor);
+                }
+            }
+
+            rowAddress += pitch;
+        }
+    }
+}
+
 // Based on https://en.wikipedia.org/wiki/3D_projection#Perspective_projection
 Math::Vector2D Graphics::projectPoint(const Math::Vector3D &vertex, const Math::Vector3D &cameraPosition, const Math::Vector3D &cameraRotation) {
-    const auto unitVector = Math::Vector3D(0, 0, 1);
-    const auto lineDirection = unitVector.rotate(cameraRotation);
-    const auto distanceToClosestPointOnLine = (vertex - cameraPosition) * lineDirection;
+    const auto viewProjection = Math::Matrix4x4::perspective(FIELD_OF_VIEW) * createViewMatrix(cameraPosition, cameraRotation);
 
-    if (distanceToClosestPointOnLine <= 0) {
-        return Util::Math::Vector2D(-2, -2);
-    }
+    auto projection = Math::Vector2D(-2, -2);
+    viewProjection.project(vertex, projection);
+    return projection;
+}
 
-    // Convert degree to radians
-    const auto cameraRotationRadians = cameraRotation * (Math::PI / 180);
+Math::Matrix4x4 Graphics::createViewMatrix(const Math::Vector3D &cameraPosition, const Math::Vector3D &cameraRotation) {
+    // The camera rotation is the inverse (i.e. transposed) rotation of an object with the same angles
+    return Math::Matrix4x4::rotation(cameraRotation).transpose() * Math::Matrix4x4::translation(cameraPosition * -1);
+}
 
-    const double x = cameraRotationRadians.getX();
-    const double y = cameraRotationRadians.getY();
-    const double z = cameraRotationRadians.getZ();
+Math::Vector2D Graphics::projectPoint(const Math::Vector3D &vertex) const {
+    auto projection = Math::Vector2D(-2, -2);
+    viewProjectionMatrix.project(vertex, projection);
+    return projection;
+}
 
-    const double sinX = Util::Math::sine(x);
-    const double cosX = Util::Math::cosine(x);
-    const double sinY = Util::Math::sine(y);
-    const double cosY = Util::Math::cosine(y);
-    const double sinZ = Util::Math::sine(z);
-    const double cosZ = Util::Math::cosine(z);
+bool Graphics::isSphereVisible(const Math::Vector3D &center, double radius) const {
+    const auto viewCenter = viewMatrix * center;
 
-    const auto rotationMatrix = Math::Matrix3x3 {
-            cosY * cosZ, cosY * sinZ, -sinY,
-            sinX * sinY * cosZ - cosX * sinZ, sinX * sinY * sinZ + cosX * cosZ, sinX * cosY,
-            cosX * sinY * cosZ + sinX * sinZ, cosX * sinY * sinZ - sinX * cosZ, cosX * cosY
-    };
+    // Sphere lies completely behind the camera
+    if (viewCenter.getZ() < -radius) {
+        return false;
+    }
 
-    const auto d = rotationMatrix * (vertex - cameraPosition);
-    const auto e = Util::Math::Vector3D(0, 0, FIELD_OF_VIEW);
-    const auto a = d.getZ() == 0 ? 1 : e.getZ() / d.getZ();
+    // A point is visible, if FIELD_OF_VIEW * |x| <= z and FIELD_OF_VIEW * |y| <= z.
+    // Check the sphere's signed distance to each of the four side planes, defined by these conditions.
+    const auto normalLength = Math::sqrt(FIELD_OF_VIEW * FIELD_OF_VIEW + 1);
+    const auto maxDistance = radius * normalLength;
+    const auto scaledX = FIELD_OF_VIEW * viewCenter.getX();
+    const auto scaledY = FIELD_OF_VIEW * viewCenter.getY();
+    const auto z = viewCenter.getZ();
 
-    return {
-            a * d.getX() + e.getX(),
-            a * d.getY() + e.getY()
-    };
+    return scaledX - z <= maxDistance && -scaledX - z <= maxDistance && scaledY - z <= maxDistance && -scaledY - z <= maxDistance;
 }
 
 void Graphics::drawLine3D(const Math::Vector3D &from, const Math::Vector3D &to) {
-    const auto v1 = projectPoint(from, cameraPosition, cameraRotation);
-    const auto v2 = projectPoint(to, cameraPosition, cameraRotation);
+    drawProjectedLine(projectPoint(from), projectPoint(to));
+}
 
+void Graphics::drawProjectedLine(const Math::Vector2D &v1, const Math::Vector2D &v2) {
     // Do not draw line, if both points are outside the camera view range
     if ((v1.getX() < -1 || v1.getX() > 1 || v1.getY() < -1 || v1.getY() > 1) && (v2.getX() < -1 || v2.getX() > 1 || v2.getY() < -1 || v2.getY() > 1)) {
         return;
@@ -227,6 +307,14 @@ void Graphics::drawModel(const Array<Math::Vector3D> &vertices, const Array<Math
     const auto numEdges = edges.length();
     edgeCounter += numEdges;
 
+    if (projectionBuffer.length() < vertices.length()) {
+        projectionBuffer = Array<Math::Vector2D>(vertices.length());
+    }
+
+    for (uint32_t i = 0; i < vertices.length(); i++) {
+        projectionBuffer[i] = projectPoint(vertices[i]);
+    }
+
     for (uint32_t i = 0; i < numEdges; i++) {
         const auto edge = edges[i];
         const auto x = static_cast<int32_t>(edge.getX());
@@ -237,10 +325,80 @@ void Graphics::drawModel(const Array<Math::Vector3D> &vertices, const Array<Math
             continue;
         }
 
-        drawLine3D(vertices[x], vertices[y]);
+        drawProjectedLine(projectionBuffer[x], projectionBuffer[y]);
     }
 }
 
+void Graphics::fillModel(const Array<Math::Vector3D> &vertices, const Array<uint32_t> &triangles) {
+    const auto numTriangles = triangles.length() / 3;
+    triangleCounter += numTriangles;
+
+    if (rasterizer == nullptr) {
+        rasterizer = new Graphic::Rasterizer(lfb);
+    }
+
+    // Transform each vertex once into screen space (x, y in pixels, z in view space)
+    if (screenBuffer.length() < vertices.length()) {
+        screenBuffer = Array<Math::Vector3D>(vertices.length());
+    }
+
+    const auto halfResolutionX = lfb.getResolutionX() / 2.0;
+    const auto halfResolutionY = lfb.getResolutionY() / 2.0;
+    for (uint32_t i = 0; i < vertices.length(); i++) {
+        const auto viewVertex = viewMatrix * vertices[i];
+        const auto z = viewVertex.getZ();
+        if (z < NEAR_PLANE) {
+            screenBuffer[i] = Math::Vector3D(0, 0, z);
+            continue;
+        }
+
+        const auto a = FIELD_OF_VIEW / z;
+        screenBuffer[i] = Math::Vector3D((a * viewVertex.getX() + 1) * halfResolutionX, lfb.getResolutionY() - (a * viewVertex.getY() + 1) * halfResolutionY, z);
+    }
+
+    for (uint32_t i = 0; i < numTriangles; i++) {
+        const auto index1 = triangles[i * 3];
+        const auto index2 = triangles[i * 3 + 1];
+        const auto index3 = triangles[i * 3 + 2];
+        const auto &v1 = vertices[index1];
+
+        // Back-face culling: The face normal (counter-clockwise winding) must point towards the camera
+        const auto normal = (vertices[index2] - v1).cross(vertices[index3] - v1);
+        const auto toCamera = cameraPosition - v1;
+        const auto facing = normal * toCamera;
+        if (facing <= 0) {
+            continue;
+        }
+
+        const auto &s1 = screenBuffer[index1];
+        const auto &s2 = screenBuffer[index2];
+        const auto &s3 = screenBuffer[index3];
+        if (s1.getZ() < NEAR_PLANE || s2.getZ() < NEAR_PLANE || s3.getZ() < NEAR_PLANE) {
+            continue;
+        }
+
+        // Flat shading with a light source at the camera position
+        const auto intensity = AMBIENT_LIGHT + (1 - AMBIENT_LIGHT) * (facing / (normal.length() * toCamera.length()));
+        const auto shadedColor = Graphic::Color(static_cast<uint8_t>(color.getRed() * intensity), static_cast<uint8_t>(color.getGreen() * intensity), static_cast<uint8_t>(color.getBlue() * intensity));
+
+        if (rasterizer->fillTriangle(static_cast<int32_t>(s1.getX()), static_cast<int32_t>(s1.getY()), toDepth(s1.getZ()),
+                                     static_cast<int32_t>(s2.getX()), static_cast<int32_t>(s2.getY()), toDepth(s2.getZ()),
+                                     static_cast<int32_t>(s3.getX()), static_cast<int32_t>(s3.getY()), toDepth(s3.getZ()), shadedColor)) {
+            drawnTriangleCounter++;
+            depthBufferDirty = true;
+        }
+    }
+}
+
+uint32_t Graphics::getDrawnTriangleCounter() const {
+    return drawnTriangleCounter;
+}
+
+uint16_t Graphics::toDepth(double z) {
+    // Map 1/z linearly, so that depth can be interpolated linearly in screen space
+    return static_cast<uint16_t>(Graphic::Rasterizer::MAX_DEPTH * (1 - NEAR_PLANE / z));
+}
+
 void Graphics::show() const {
     lfb.flush();
 
@@ -306,15 +464,25 @@ void Graphics::update() {
     auto &camera = game.getCurrentScene().getCamera();
     cameraPosition = camera.getPosition();
     cameraRotation = camera.getRotation();
+
+    // Sine and cosine of the camera rotation are calculated once per frame, instead of once per projected vertex
+    viewMatrix = createViewMatrix(cameraPosition, cameraRotation);
+    viewProjectionMatrix = Math::Matrix4x4::perspective(FIELD_OF_VIEW) * viewMatrix;
+
+    if (depthBufferDirty) {
+        rasterizer->clearDepthBuffer();
+        depthBufferDirty = false;
+    }
 }
 
 void Graphics::resetCounters() {
     edgeCounter = 0;
     drawnEdgeCounter = 0;
+    triangleCounter = 0;
+    drawnTriangleCounter = 0;
 }
 
 void Graphics::drawImageDirect2D(const Math::Vector2D &position, const Graphic::Image &image, bool flipX, double alpha) const {
-    const auto *pixelBuffer = image.getPixelBuffer();
     const auto xPixelOffset = static_cast<int32_t>((position.getX() - cameraPosition.getX()) * transformation + offsetX);
     const auto yPixelOffset = static_cast<int32_t>((-position.getY() + cameraPosition.getY()) * transformation + offsetY);
 
@@ -322,12 +490,9 @@ void Graphics::drawImageDirect2D(const Math::Vector2D &position, const Graphic::
         return;
     }
 
-    for (uint32_t i = 0; i < image.getHeight(); i++) {
-        for (uint32_t j = 0; j < image.getWidth(); j++) {
-            const auto &pixel = pixelBuffer[i * image.getWidth() + (flipX ? image.getWidth() - j : j)];
-            pixelDrawer.drawPixel(xPixelOffset + j, yPixelOffset - i, pixel.withAlpha(static_cast<uint8_t>(pixel.getAlpha() * alpha)));
-        }
-    }
+    // Images are stored bottom to top, with the first row at the given position
+    const auto &surface = image.getSurface(lfb.getColorDepth(), flipX);
+    surfaceDrawer.drawSurface(xPixelOffset, yPixelOffset - (image.getHeight() - 1), surface, static_cast<uint8_t>(255 * alpha));
 }
 
 void Graphics::drawImageScaled2D(const Math::Vector2D &position, const Graphic::Image &image, bool flipX, double alpha, const Math::Vector2D &scale) const {
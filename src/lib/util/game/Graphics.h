@@ -31,7 +31,9 @@
 
 #include "lib/util/graphic/BufferedLinearFrameBuffer.h"
 #include "lib/util/graphic/LineDrawer.h"
-#include "lib/util/graphic/StringDrawer.h"
+#include "lib/util/graphic/font/GlyphCache.h"
+#include "lib/util/graphic/SurfaceDrawer.h"
+#include "lib/util/graphic/Rasterizer.h"
 #include "lib/util/graphic/Colors.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/graphic/Color.h"
@@ -39,6 +41,7 @@
 #include "lib/util/base/String.h"
 #include "lib/util/math/Vector3D.h"
 #include "lib/util/math/Vector2D.h"
+#include "lib/util/math/Matrix4x4.h"
 
 namespace Util {
 
@@ -78,7 +81,7 @@ public:
     /**
      * Destructor.
      */
-    ~Graphics() = default;
+    ~Graphics();
 
     /***** Basic functions to draw directly on the screen ******/
 
@@ -118,14 +121,46 @@ public:
 
     void drawImage2D(const Math::Vector2D &position, const Graphic::Image &image, bool flipX = false, double alpha = 1, const Math::Vector2D &scale = Util::Math::Vector2D(1, 1), double rotationAngle = 0) const;
 
+    /**
+     * Draw a batch of particles as squares, centered at the given positions, in a single pass.
+     * Pixels are written directly into the frame buffer. With 32 bits per pixel, particles are alpha blended.
+     * With lower color depths, particles with an alpha value below 128 are skipped and all others are drawn opaque.
+     *
+     * @param positionsX The x coordinates of all particles
+     * @param positionsY The y coordinates of all particles
+     * @param colors The colors of all particles, encoded as RGB32 values with alpha in the upper byte
+     * @param count The amount of particles
+     * @param size The edge length of a particle in world units (at least one pixel is drawn)
+     */
+    void drawParticles2D(const float *positionsX, const float *positionsY, const uint32_t *colors, uint32_t count, double size) const;
+
     /***** 2D drawing functions *****/
 
     [[nodiscard]] static Math::Vector2D projectPoint(const Math::Vector3D &vertex, const Math::Vector3D &cameraPosition, const Math::Vector3D &cameraRotation) ;
 
     void drawLine3D(const Math::Vector3D &from, const Math::Vector3D &to);
 
+    /**
+     * Draw the edges of a model. Each vertex is projected only once, regardless of how many edges it belongs to.
+     */
     void drawModel(const Array<Math::Vector3D> &vertices, const Array<Math::Vector2D> &edges);
 
+    /**
+     * Check if a bounding sphere intersects the camera's view frustum, using the view matrix of the current frame.
+     */
+    [[nodiscard]] bool isSphereVisible(const Math::Vector3D &center, double radius) const;
+
+    /**
+     * Draw the triangles of a model as filled, flat shaded polygons with hidden surface removal.
+     * Triangles facing away from the camera are culled. Triangles reaching behind the near plane are skipped (no clipping).
+     *
+     * @param vertices The model's vertices in world space
+     * @param triangles Three consecutive vertex indices per triangle
+     */
+    void fillModel(const Array<Math::Vector3D> &vertices, const Array<uint32_t> &triangles);
+
+    [[nodiscard]] uint32_t getDrawnTriangleCounter() const;
+
     /***** Miscellaneous *****/
 
     void clear(const Graphic::Color &color = Util::Graphic::Colors::BLACK);
@@ -154,12 +189,21 @@ private:
 
     void resetCounters();
 
+    [[nodiscard]] static Math::Matrix4x4 createViewMatrix(const Math::Vector3D &cameraPosition, const Math::Vector3D &cameraRotation);
+
+    [[nodiscard]] Math::Vector2D projectPoint(const Math::Vector3D &vertex) const;
+
+    void drawProjectedLine(const Math::Vector2D &v1, const Math::Vector2D &v2);
+
+    [[nodiscard]] static uint16_t toDepth(double z);
+
     Game &game;
 
     const Graphic::BufferedLinearFrameBuffer lfb;
     const Graphic::PixelDrawer pixelDrawer;
     const Graphic::LineDrawer lineDrawer;
-    const Graphic::StringDrawer stringDrawer;
+    const Graphic::GlyphCache glyphCache;
+    const Graphic::SurfaceDrawer surfaceDrawer;
 
     const uint16_t transformation;
     const uint16_t offsetX;
@@ -167,15 +211,27 @@ private:
 
     Math::Vector3D cameraPosition{};
     Math::Vector3D cameraRotation{};
+    Math::Matrix4x4 viewMatrix{};
+    Math::Matrix4x4 viewProjectionMatrix{};
+    Array<Math::Vector2D> projectionBuffer = Array<Math::Vector2D>(0);
+    Array<Math::Vector3D> screenBuffer = Array<Math::Vector3D>(0);
+
+    // Depth buffer is only allocated, once the first model is filled
+    Graphic::Rasterizer *rasterizer = nullptr;
+    bool depthBufferDirty = false;
 
     uint8_t *backgroundBuffer = nullptr;
 
     uint32_t edgeCounter = 0;
     uint32_t drawnEdgeCounter = 0;
+    uint32_t triangleCounter = 0;
+    uint32_t drawnTriangleCounter = 0;
 
     Graphic::Color color = Graphic::Colors::WHITE;
 
     static const constexpr double FIELD_OF_VIEW = 1.3;
+    static const constexpr double NEAR_PLANE = 0.1;
+    static const constexpr double AMBIENT_LIGHT = 0.25;
 };
 
 }
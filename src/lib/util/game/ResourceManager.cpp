@@ -27,6 +27,7 @@
 #include "lib/util/collection/HashMap.h"
 #include "lib/util/graphic/Image.h"
 #include "lib/util/game/3d/ObjectFile.h"
+#include "lib/util/io/file/File.h"
 
 namespace Util::Game {
 
@@ -80,4 +81,14 @@ void ResourceManager::deleteObjectFile(const String &key) {
     objectFiles.remove(key);
 }
 
+D3::ObjectFile* ResourceManager::loadObjectFile(const String &path) {
+    if (!objectFiles.containsKey(path)) {
+        const auto meshPath = path.endsWith(".obj") ? path.substring(0, path.length() - 4) + ".mesh" : path;
+        auto *objectFile = D3::ObjectFile::open(Io::File(meshPath).exists() ? meshPath : path);
+        objectFiles.put(path, objectFile);
+    }
+
+    return objectFiles.get(path);
+}
+
 }
\ No newline at end of file
@@ -80,6 +80,12 @@ public:
 
     static void deleteObjectFile(const String &key);
 
+    /**
+     * Get a cached model or load it, if it has not been loaded yet.
+     * For "model.obj", a binary mesh file "model.mesh" in the same directory is preferred, since it needs no parsing.
+     */
+    static D3::ObjectFile* loadObjectFile(const String &path);
+
     static void clear();
 
 private:
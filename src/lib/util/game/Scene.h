@@ -98,6 +98,10 @@ protected:
     ArrayList<Entity*> entities;
     ArrayList<Entity*> addList;
     ArrayList<Entity*> removeList;
+
+    // Collision statistics of the last frame, shown in the engine's status overlay
+    uint32_t collisionCheckCounter = 0;
+    uint32_t collisionCounter = 0;
 };
 
 }
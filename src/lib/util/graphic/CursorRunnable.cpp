@@ -21,7 +21,7 @@
 #include "lib/util/async/Thread.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/graphic/Font.h"
-#include "lib/util/graphic/StringDrawer.h"
+#include "lib/util/graphic/font/GlyphCache.h"
 #include "lib/util/time/Timestamp.h"
 
 namespace Util::Graphic {
@@ -47,13 +47,13 @@ void CursorRunnable::stop() {
 }
 
 void CursorRunnable::draw() {
-    const auto character = terminal.characterBuffer[terminal.currentRow * terminal.getColumns() + terminal.currentColumn];
-    terminal.stringDrawer.drawChar(terminal.font,
-                                   terminal.currentColumn * terminal.font.getCharWidth(),
-                                   terminal.currentRow * terminal.font.getCharHeight(),
-                                   visible ? cursor : character.value,
-                                   character.foregroundColor,
-                                   character.backgroundColor);
+    const auto character = terminal.getCharacter(terminal.currentColumn, terminal.currentRow);
+    terminal.glyphCache.drawChar(terminal.lfb, terminal.font,
+                                 terminal.currentColumn * terminal.font.getCharWidth(),
+                                 terminal.currentRow * terminal.font.getCharHeight(),
+                                 visible ? cursor : character.value,
+                                 character.foregroundColor,
+                                 character.backgroundColor);
 }
 
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "Image.h"
 
 #include "lib/util/graphic/Color.h"
+#include "lib/util/graphic/Surface.h"
 
 namespace Util::Graphic {
 
@@ -27,6 +28,8 @@ Image::Image(uint16_t width, uint16_t height, Color *pixelBuffer) : width(width)
 
 Image::~Image() {
     delete[] pixelBuffer;
+    delete surface;
+    delete flippedSurface;
 }
 
 Graphic::Color* Image::getPixelBuffer() const {
@@ -57,4 +60,14 @@ Image* Image::scale(uint16_t newWidth, uint16_t newHeight) {
     return new Image(newWidth, newHeight, newPixelBuffer);
 }
 
+const Surface& Image::getSurface(uint8_t colorDepth, bool flipX) const {
+    auto *&cachedSurface = flipX ? flippedSurface : surface;
+    if (cachedSurface == nullptr || cachedSurface->getColorDepth() != colorDepth) {
+        delete cachedSurface;
+        cachedSurface = new Surface(*this, colorDepth, flipX);
+    }
+
+    return *cachedSurface;
+}
+
 }
\ No newline at end of file
@@ -23,6 +23,7 @@
 namespace Util {
 namespace Graphic {
 class Color;
+class Surface;
 }  // namespace Graphic
 }  // namespace Util
 
@@ -59,11 +60,20 @@ public:
 
     [[nodiscard]] Image* scale(uint16_t newWidth, uint16_t newHeight);
 
+    /**
+     * Get a copy of this image in the native format of a frame buffer with the given color depth.
+     * The surface is created on first use and kept until the image is destroyed (or a different color depth is requested).
+     */
+    [[nodiscard]] const Surface& getSurface(uint8_t colorDepth, bool flipX) const;
+
 private:
 
     const uint16_t width;
     const uint16_t height;
     Graphic::Color *pixelBuffer;
+
+    mutable Surface *surface = nullptr;
+    mutable Surface *flippedSurface = nullptr;
 };
 
 }
@@ -27,8 +27,12 @@ namespace Util::Graphic {
 
 LinearFrameBufferTerminal::LinearFrameBufferTerminal(Util::Graphic::LinearFrameBuffer *lfb, Util::Graphic::Font &font, char cursor) :
         Terminal(lfb->getResolutionX() / font.getCharWidth(), lfb->getResolutionY() / font.getCharHeight()),
-        characterBuffer(new Character[getColumns() * getRows()]), lfb(*lfb), pixelDrawer(*lfb), stringDrawer(pixelDrawer), shadowLfb(*lfb, false),
-        shadowPixelDrawer(shadowLfb), shadowStringDrawer(shadowPixelDrawer), shadowScroller(shadowLfb, false), font(font), cursor(cursor) {
+        characterBuffer(new Character[getColumns() * getRows()]), dirtyRanges(new DirtyRange[getRows()]), lfb(*lfb), shadowLfb(*lfb, false),
+        shadowScroller(shadowLfb, false), font(font), cursor(cursor) {
+    for (uint32_t i = 0; i < getRows(); i++) {
+        dirtyRanges[i] = {0, 0};
+    }
+
     Terminal::clear();
     LinearFrameBufferTerminal::setCursor(true);
 }
@@ -37,18 +41,14 @@ LinearFrameBufferTerminal::~LinearFrameBufferTerminal() {
     LinearFrameBufferTerminal::setCursor(false);
     delete &lfb;
     delete[] characterBuffer;
+    delete[] dirtyRanges;
 }
 
 void LinearFrameBufferTerminal::putChar(char c, const Util::Graphic::Color &foregroundColor, const Util::Graphic::Color &backgroundColor) {
-    while (!cursorLock.tryAcquire()) {
-        cursorLock.release();
-        Util::Async::Thread::yield();
-    }
-
-    characterBuffer[currentRow * getColumns() + currentColumn] = {c, foregroundColor, backgroundColor};
+    acquireLock();
 
-    stringDrawer.drawChar(font, currentColumn * font.getCharWidth(), currentRow * font.getCharHeight(), c, foregroundColor, backgroundColor);
-    shadowStringDrawer.drawChar(font, currentColumn * font.getCharWidth(), currentRow * font.getCharHeight(), c, foregroundColor, backgroundColor);
+    getCharacter(currentColumn, currentRow) = {c, foregroundColor, backgroundColor};
+    markDirty(currentRow, currentColumn, currentColumn + 1);
     currentColumn++;
 
     if (currentColumn >= getColumns()) {
@@ -66,59 +66,31 @@ void LinearFrameBufferTerminal::putChar(char c, const Util::Graphic::Color &fore
 }
 
 void LinearFrameBufferTerminal::clear(const Util::Graphic::Color &foregroundColor, const Util::Graphic::Color &backgroundColor, uint16_t startColumn, uint32_t startRow, uint16_t endColumn, uint16_t endRow) {
-    while (!cursorLock.tryAcquire()) {
-        cursorLock.release();
-        Util::Async::Thread::yield();
+    if (startRow > endRow) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Terminal: Invalid arguments for clear()!");
     }
 
-    if (startRow == endRow) {
-        // Clear from start column to end column
-        for (uint32_t i = 0; i < static_cast<uint32_t>(endColumn - startColumn + 1) * font.getCharWidth(); i++) {
-            for (uint32_t j = 0; j < font.getCharHeight(); j++) {
-                shadowPixelDrawer.drawPixel((startColumn * font.getCharWidth()) + i, (startRow * font.getCharHeight()) + j, backgroundColor);
-            }
-        }
-    } else if (startRow < endRow) {
-        // Clear from start position to end of line
-        for (uint32_t y = 0; y < font.getCharHeight(); y++) {
-            for (uint32_t x = 0; x < static_cast<uint32_t>(getColumns() - startColumn) * font.getCharWidth(); x++) {
-                shadowPixelDrawer.drawPixel((startColumn * font.getCharWidth()) + x, (startRow * font.getCharHeight()) + y, backgroundColor);
-            }
-        }
+    acquireLock();
 
-        // Clear from next line to before last line
-        for (uint32_t y = 0; y < (endRow - startRow - 1) * font.getCharHeight(); y++) {
-            for (uint32_t x = 0; x < getColumns() * font.getCharWidth(); x++) {
-                shadowPixelDrawer.drawPixel(x, ((startRow + 1) * font.getCharHeight()) + y, backgroundColor);
-            }
-        }
+    for (uint32_t row = startRow; row <= endRow && row < getRows(); row++) {
+        uint16_t firstColumn = row == startRow ? startColumn : 0;
+        uint16_t lastColumn = row == endRow && endColumn < getColumns() ? endColumn : getColumns() - 1;
 
-        // Clear from beginning of last line to end position
-        for (uint32_t y = 0; y < font.getCharHeight(); y++) {
-            for (uint32_t x = 0; x < endColumn * font.getCharWidth(); x++) {
-                shadowPixelDrawer.drawPixel(x, (endRow * font.getCharHeight()) + y, backgroundColor);
-            }
+        for (uint32_t column = firstColumn; column <= lastColumn; column++) {
+            getCharacter(column, row) = {'\0', foregroundColor, backgroundColor};
         }
-    } else {
-        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Terminal: Invalid arguments for clear()!");
-    }
 
-    for (uint32_t i = startRow * getColumns() + startColumn; i < static_cast<uint32_t>(endRow * getColumns()) + endColumn + 1; i++) {
-        characterBuffer[i] = {'\0', foregroundColor, backgroundColor};
+        markDirty(row, firstColumn, lastColumn + 1);
     }
 
-    shadowLfb.flush();
     cursorLock.release();
 }
 
 void LinearFrameBufferTerminal::setPosition(uint16_t column, uint16_t row) {
-    while (!cursorLock.tryAcquire()) {
-        cursorLock.release();
-        Util::Async::Thread::yield();
-    }
+    acquireLock();
 
-    auto character = characterBuffer[currentRow * getColumns() + currentColumn];
-    stringDrawer.drawChar(font, currentColumn * font.getCharWidth(), currentRow * font.getCharHeight(), character.value, character.foregroundColor, character.backgroundColor);
+    // The cursor may currently be drawn over the old position
+    markDirty(currentRow, currentColumn, currentColumn + 1);
 
     currentColumn = column;
     currentRow = row;
@@ -135,7 +107,8 @@ void LinearFrameBufferTerminal::setCursor(bool enabled) {
     cursorLock.acquire();
 
     if (enabled) {
-        shadowLfb.flush();
+        // The screen may have been overwritten by another application -> Redraw everything
+        repaint(true);
 
         if (cursorRunnable != nullptr) {
             cursorLock.release();
@@ -152,16 +125,107 @@ void LinearFrameBufferTerminal::setCursor(bool enabled) {
     cursorLock.release();
 }
 
+void LinearFrameBufferTerminal::flush() {
+    acquireLock();
+    repaint(false);
+    cursorLock.release();
+}
+
+void LinearFrameBufferTerminal::repaint(bool copyAll) {
+    // Apply all scroll operations since the last repaint at once
+    if (pendingScrollLines > 0) {
+        if (pendingScrollLines < getRows()) {
+            shadowScroller.scrollUp(pendingScrollLines * font.getCharHeight(), false);
+        }
+
+        copyAll = true;
+    }
+
+    for (uint16_t row = 0; row < getRows(); row++) {
+        auto &range = dirtyRanges[getBufferRow(row)];
+        if (range.isEmpty()) {
+            continue;
+        }
+
+        for (uint16_t column = range.startColumn; column < range.endColumn; column++) {
+            const auto &character = getCharacter(column, row);
+            glyphCache.drawChar(shadowLfb, font, column * font.getCharWidth(), row * font.getCharHeight(), character.value, character.foregroundColor, character.backgroundColor);
+        }
+
+        if (!copyAll) {
+            copyToScreen(row, range.startColumn, range.endColumn);
+        }
+
+        range = {0, 0};
+    }
+
+    if (copyAll) {
+        shadowLfb.flush();
+    }
+
+    pendingScrollLines = 0;
+}
+
 void LinearFrameBufferTerminal::scrollUp() {
-    // Scroll character buffer
-    auto characterAddress = Util::Address<uint32_t>(characterBuffer);
-    characterAddress.copyRange(characterAddress.add(getColumns() * sizeof(Character)), getColumns() * (getRows() - 1) * sizeof(Character));
+    // Only the ring buffer offset is moved; the screen is scrolled on the next repaint
+    scrollOffset = (scrollOffset + 1) % getRows();
+    if (pendingScrollLines < getRows()) {
+        pendingScrollLines++;
+    }
 
-    // Scroll shadow LFB
-    shadowScroller.scrollUp(font.getCharHeight(), false);
+    // Clear last line (the former first line)
+    const auto lastRow = getRows() - 1;
+    for (uint16_t column = 0; column < getColumns(); column++) {
+        getCharacter(column, lastRow) = {'\0', getForegroundColor(), getBackgroundColor()};
+    }
 
-    // Clear last line (Also flushes shadow buffer)
-    clear(getForegroundColor(), getBackgroundColor(), 0, getRows() - 1, getColumns() - 1, getRows() - 1);
+    dirtyRanges[getBufferRow(lastRow)] = {0, getColumns()};
+}
+
+uint16_t LinearFrameBufferTerminal::getBufferRow(uint16_t row) const {
+    return (scrollOffset + row) % getRows();
+}
+
+LinearFrameBufferTerminal::Character& LinearFrameBufferTerminal::getCharacter(uint16_t column, uint16_t row) const {
+    return characterBuffer[getBufferRow(row) * getColumns() + column];
+}
+
+void LinearFrameBufferTerminal::markDirty(uint16_t row, uint16_t startColumn, uint16_t endColumn) {
+    if (startColumn >= endColumn) {
+        return;
+    }
+
+    auto &range = dirtyRanges[getBufferRow(row)];
+    if (range.isEmpty()) {
+        range = {startColumn, endColumn};
+        return;
+    }
+
+    if (startColumn < range.startColumn) {
+        range.startColumn = startColumn;
+    }
+
+    if (endColumn > range.endColumn) {
+        range.endColumn = endColumn;
+    }
+}
+
+void LinearFrameBufferTerminal::copyToScreen(uint16_t row, uint16_t startColumn, uint16_t endColumn) {
+    const uint32_t bytesPerPixel = (lfb.getColorDepth() + 7) / 8;
+    const uint32_t offsetX = startColumn * font.getCharWidth() * bytesPerPixel;
+    const uint32_t width = (endColumn - startColumn) * font.getCharWidth() * bytesPerPixel;
+
+    for (uint32_t y = row * font.getCharHeight(); y < static_cast<uint32_t>((row + 1) * font.getCharHeight()); y++) {
+        const uint32_t offset = y * lfb.getPitch() + offsetX;
+        lfb.getBuffer().add(offset).copyRange(shadowLfb.getBuffer().add(offset), width);
+    }
+}
+
+void LinearFrameBufferTerminal::acquireLock() {
+    while (!cursorLock.tryAcquire()) {
+        cursorLock.release();
+        Util::Async::Thread::yield();
+    }
 }
 
 uint16_t LinearFrameBufferTerminal::getCurrentColumn() const {
@@ -172,4 +236,4 @@ uint16_t LinearFrameBufferTerminal::getCurrentRow() const {
     return currentRow;
 }
 
-}
\ No newline at end of file
+}
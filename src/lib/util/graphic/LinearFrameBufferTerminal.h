@@ -21,14 +21,13 @@
 #include <cstdint>
 
 #include "lib/util/graphic/Colors.h"
-#include "lib/util/graphic/PixelDrawer.h"
-#include "lib/util/graphic/StringDrawer.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/graphic/BufferedLinearFrameBuffer.h"
 #include "lib/util/graphic/BufferScroller.h"
 #include "lib/util/graphic/Terminal.h"
 #include "lib/util/graphic/Color.h"
 #include "lib/util/graphic/font/Terminal8x16.h"
+#include "lib/util/graphic/font/GlyphCache.h"
 
 namespace Util {
 namespace Graphic {
@@ -62,6 +61,13 @@ public:
 
     void setCursor(bool enabled) override;
 
+    /**
+     * Repaint all cells, that have changed since the last call, and copy them to the screen.
+     * Output is collected in the character buffer and only rendered when the terminal is flushed,
+     * so that a large write results in a single repaint pass.
+     */
+    void flush() override;
+
     [[nodiscard]] uint16_t getCurrentColumn() const override;
 
     [[nodiscard]] uint16_t getCurrentRow() const override;
@@ -80,18 +86,39 @@ private:
         }
     };
 
+    struct DirtyRange {
+        uint16_t startColumn;
+        uint16_t endColumn;
+
+        [[nodiscard]] bool isEmpty() const {
+            return startColumn >= endColumn;
+        }
+    };
+
     void scrollUp();
 
+    void repaint(bool copyAll);
+
+    [[nodiscard]] uint16_t getBufferRow(uint16_t row) const;
+
+    [[nodiscard]] Character& getCharacter(uint16_t column, uint16_t row) const;
+
+    void markDirty(uint16_t row, uint16_t startColumn, uint16_t endColumn);
+
+    void copyToScreen(uint16_t row, uint16_t startColumn, uint16_t endColumn);
+
+    void acquireLock();
+
+    // Rows are stored as a ring buffer, starting at 'scrollOffset', so that scrolling does not need to move any cells
     Character *characterBuffer;
+    DirtyRange *dirtyRanges;
+    uint16_t scrollOffset = 0;
+    uint16_t pendingScrollLines = 0;
 
     Util::Graphic::LinearFrameBuffer &lfb;
-    Util::Graphic::PixelDrawer pixelDrawer;
-    Util::Graphic::StringDrawer stringDrawer;
-
     Util::Graphic::BufferedLinearFrameBuffer shadowLfb;
-    Util::Graphic::PixelDrawer shadowPixelDrawer;
-    Util::Graphic::StringDrawer shadowStringDrawer;
     Util::Graphic::BufferScroller shadowScroller;
+    Util::Graphic::GlyphCache glyphCache;
 
     Util::Graphic::Font &font;
     uint16_t currentColumn = 0;
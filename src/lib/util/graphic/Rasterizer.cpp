@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Rasterizer.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/graphic/Color.h"
+#include "lib/util/graphic/LinearFrameBuffer.h"
+
+namespace Util::Graphic {
+
+static inline int32_t minimum(int32_t a, int32_t b, int32_t c) {
+    return a < b ? (a < c ? a : c) : (b < c ? b : c);
+}
+
+static inline int32_t maximum(int32_t a, int32_t b, int32_t c) {
+    return a > b ? (a > c ? a : c) : (b > c ? b : c);
+}
+
+static inline int32_t clamp(int32_t value, int32_t min, int32_t max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+static inline bool isInGuardBand(int32_t value) {
+    return value >= -Rasterizer::GUARD_BAND && value <= Rasterizer::GUARD_BAND;
+}
+
+Rasterizer::Rasterizer(const LinearFrameBuffer &lfb) : lfb(lfb), depthBuffer(new uint16_t[lfb.getResolutionX() * lfb.getResolutionY()]) {
+    clearDepthBuffer();
+}
+
+Rasterizer::~Rasterizer() {
+    delete[] depthBuffer;
+}
+
+void Rasterizer::clearDepthBuffer() {
+    Address<uint32_t>(depthBuffer).setRange(0xff, lfb.getResolutionX() * lfb.getResolutionY() * sizeof(uint16_t));
+}
+
+bool Rasterizer::fillTriangle(int32_t x1, int32_t y1, uint16_t z1, int32_t x2, int32_t y2, uint16_t z2, int32_t x3, int32_t y3, uint16_t z3, const Color &color) {
+    if (!isInGuardBand(x1) || !isInGuardBand(y1) || !isInGuardBand(x2) || !isInGuardBand(y2) || !isInGuardBand(x3) || !isInGuardBand(y3)) {
+        return false;
+    }
+
+    // Edge function E(a, b, p) = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x) is positive for all points p inside the triangle,
+    // if the vertices are ordered, so that the area is positive -> Swap vertices, if necessary
+    auto area = (x2 - x1) * (y3 - y1) - (y2 - y1) * (x3 - x1);
+    if (area == 0) {
+        return false;
+    }
+
+    if (area < 0) {
+        auto tmpX = x2, tmpY = y2;
+        auto tmpZ = z2;
+        x2 = x3; y2 = y3; z2 = z3;
+        x3 = tmpX; y3 = tmpY; z3 = tmpZ;
+        area = -area;
+    }
+
+    // Bounding box, clipped to the screen
+    auto minX = clamp(minimum(x1, x2, x3), 0, lfb.getResolutionX() - 1);
+    auto minY = clamp(minimum(y1, y2, y3), 0, lfb.getResolutionY() - 1);
+    auto maxX = clamp(maximum(x1, x2, x3), 0, lfb.getResolutionX() - 1);
+    auto maxY = clamp(maximum(y1, y2, y3), 0, lfb.getResolutionY() - 1);
+    if (maximum(x1, x2, x3) < 0 || maximum(y1, y2, y3) < 0 || minimum(x1, x2, x3) >= lfb.getResolutionX() || minimum(y1, y2, y3) >= lfb.getResolutionY()) {
+        return false;
+    }
+
+    // Edge function values at the top left corner of the bounding box and their increments
+    const int32_t stepX12 = -(y2 - y1), stepY12 = x2 - x1;
+    const int32_t stepX23 = -(y3 - y2), stepY23 = x3 - x2;
+    const int32_t stepX31 = -(y1 - y3), stepY31 = x1 - x3;
+    auto rowEdge12 = (x2 - x1) * (minY - y1) - (y2 - y1) * (minX - x1);
+    auto rowEdge23 = (x3 - x2) * (minY - y2) - (y3 - y2) * (minX - x2);
+    auto rowEdge31 = (x1 - x3) * (minY - y3) - (y1 - y3) * (minX - x3);
+
+    // Depth is a linear function of the screen coordinates -> Calculate the plane gradients in fixed point
+    const double invertedArea = 1.0 / area;
+    const double depthX = ((z2 - z1) * static_cast<double>(y3 - y1) - (z3 - z1) * static_cast<double>(y2 - y1)) * invertedArea;
+    const double depthY = ((z3 - z1) * static_cast<double>(x2 - x1) - (z2 - z1) * static_cast<double>(x3 - x1)) * invertedArea;
+    const auto depthStepX = static_cast<int32_t>(depthX * (1 << DEPTH_FRACTION_BITS));
+    const auto depthStepY = static_cast<int32_t>(depthY * (1 << DEPTH_FRACTION_BITS));
+    auto rowDepth = static_cast<int32_t>((z1 + depthX * (minX - x1) + depthY * (minY - y1)) * (1 << DEPTH_FRACTION_BITS));
+
+    const auto depth = lfb.getColorDepth();
+    const auto bytesPerPixel = (depth == 15 ? 16 : depth) / 8;
+    const auto pitch = lfb.getPitch();
+    const auto resolutionX = lfb.getResolutionX();
+    const uint32_t nativeColor = depth == 32 ? color.getRGB32() : depth == 24 ? color.getRGB24() : depth == 16 ? color.getRGB16() : color.getRGB15();
+    auto *rowAddress = reinterpret_cast<uint8_t*>(lfb.getBuffer().get()) + minY * pitch;
+
+    for (int32_t y = minY; y <= maxY; y++) {
+        auto edge12 = rowEdge12, edge23 = rowEdge23, edge31 = rowEdge31;
+        auto currentDepth = rowDepth;
+        auto *depthRow = depthBuffer + y * resolutionX;
+
+        for (int32_t x = minX; x <= maxX; x++) {
+            if ((edge12 | edge23 | edge31) >= 0) {
+                auto pixelDepth = static_cast<uint16_t>(clamp(currentDepth >> DEPTH_FRACTION_BITS, 0, MAX_DEPTH));
+                if (pixelDepth < depthRow[x]) {
+                    depthRow[x] = pixelDepth;
+
+                    switch (bytesPerPixel) {
+                        case 4:
+                            reinterpret_cast<uint32_t*>(rowAddress)[x] = nativeColor;
+                            break;
+                        case 3:
+                            rowAddress[x * 3] = nativeColor & 0xff;
+                            rowAddress[x * 3 + 1] = (nativeColor >> 8) & 0xff;
+                            rowAddress[x * 3 + 2] = (nativeColor >> 16) & 0xff;
+                            break;
+                        default:
+                            reinterpret_cast<uint16_t*>(rowAddress)[x] = static_cast<uint16_t>(nativeColor);
+                            break;
+                    }
+                }
+            }
+
+            edge12 += stepX12;
+            edge23 += stepX23;
+            edge31 += stepX31;
+            currentDepth += depthStepX;
+        }
+
+        rowEdge12 += stepY12;
+        rowEdge23 += stepY23;
+        rowEdge31 += stepY31;
+        rowDepth += depthStepY;
+        rowAddress += pitch;
+    }
+
+    return true;
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_RASTERIZER_H
+#define HHUOS_RASTERIZER_H
+
+#include <cstdint>
+
+namespace Util {
+namespace Graphic {
+class Color;
+class LinearFrameBuffer;
+}  // namespace Graphic
+}  // namespace Util
+
+namespace Util::Graphic {
+
+/**
+ * Fills triangles on a linear frame buffer, using a 16-bit depth buffer for hidden surface removal.
+ * Triangles are rasterized with half-space edge functions inside their bounding box.
+ * Each row is written directly into the frame buffer memory, bypassing the PixelDrawer.
+ */
+class Rasterizer {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param lfb The linear frame buffer on which to draw triangles.
+     */
+    explicit Rasterizer(const LinearFrameBuffer &lfb);
+
+    /**
+     * Copy Constructor.
+     */
+    Rasterizer(const Rasterizer &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Rasterizer& operator=(const Rasterizer &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Rasterizer();
+
+    /**
+     * Reset all depth values to the far plane (MAX_DEPTH).
+     */
+    void clearDepthBuffer();
+
+    /**
+     * Fill a triangle with a single color. Only pixels, which are closer than the current depth buffer value, are drawn.
+     * The winding order does not matter (back-face culling is done by the caller).
+     *
+     * @param x1, y1, z1 Screen coordinates and depth (0 = nearest, MAX_DEPTH = farthest) of the first vertex
+     * @param x2, y2, z2 Screen coordinates and depth of the second vertex
+     * @param x3, y3, z3 Screen coordinates and depth of the third vertex
+     * @param color The fill color
+     * @return false, if the triangle has been rejected, because it is degenerated or outside the guard band
+     */
+    bool fillTriangle(int32_t x1, int32_t y1, uint16_t z1, int32_t x2, int32_t y2, uint16_t z2, int32_t x3, int32_t y3, uint16_t z3, const Color &color);
+
+    static const constexpr uint16_t MAX_DEPTH = UINT16_MAX;
+
+    /**
+     * Vertices must lie within this range, so that the edge functions can not overflow 32-bit integers.
+     */
+    static const constexpr int32_t GUARD_BAND = 8192;
+
+private:
+
+    const LinearFrameBuffer &lfb;
+    uint16_t *depthBuffer;
+
+    static const constexpr uint32_t DEPTH_FRACTION_BITS = 8;
+};
+
+}
+
+#endif
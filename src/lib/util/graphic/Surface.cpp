@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Surface.h"
+
+#include "lib/util/graphic/Color.h"
+#include "lib/util/graphic/Image.h"
+
+namespace Util::Graphic {
+
+Surface::Surface(const Image &image, uint8_t colorDepth, bool flipX) :
+        image(image), width(image.getWidth()), height(image.getHeight()), colorDepth(colorDepth),
+        bytesPerPixel(colorDepth == 15 ? 2 : (colorDepth + 7) / 8), flipX(flipX),
+        pixels(new uint8_t[width * height * bytesPerPixel]), alpha(new uint8_t[width * height]), rowRuns(new uint32_t[height + 1]) {
+    // Convert pixels and count runs, so that the run array can be allocated at once
+    uint32_t runCount = 0;
+    for (uint16_t row = 0; row < height; row++) {
+        int16_t previousType = -1;
+        for (uint16_t column = 0; column < width; column++) {
+            const auto &color = getColor(column, row);
+            const auto value = color.getColorForDepth(colorDepth);
+            auto *target = pixels + (row * width + column) * bytesPerPixel;
+
+            switch (bytesPerPixel) {
+                case 2:
+                    *reinterpret_cast<uint16_t*>(target) = static_cast<uint16_t>(value);
+                    break;
+                case 3:
+                    target[0] = value & 0xff;
+                    target[1] = (value >> 8) & 0xff;
+                    target[2] = (value >> 16) & 0xff;
+                    break;
+                default:
+                    *reinterpret_cast<uint32_t*>(target) = value;
+                    break;
+            }
+
+            alpha[row * width + column] = color.getAlpha();
+
+            int16_t type = color.getAlpha() == 0 ? -1 : (color.getAlpha() == 255 ? 1 : 0);
+            if (type != -1 && type != previousType) {
+                runCount++;
+            }
+
+            previousType = type;
+        }
+    }
+
+    runs = new Run[runCount > 0 ? runCount : 1];
+
+    uint32_t index = 0;
+    for (uint16_t row = 0; row < height; row++) {
+        rowRuns[row] = index;
+
+        int16_t previousType = -1;
+        for (uint16_t column = 0; column < width; column++) {
+            const auto pixelAlpha = alpha[row * width + column];
+            int16_t type = pixelAlpha == 0 ? -1 : (pixelAlpha == 255 ? 1 : 0);
+
+            if (type != -1) {
+                if (type == previousType) {
+                    runs[index - 1].length++;
+                } else {
+                    runs[index++] = Run{column, 1, type == 1};
+                }
+            }
+
+            previousType = type;
+        }
+    }
+
+    rowRuns[height] = index;
+}
+
+Surface::~Surface() {
+    delete[] pixels;
+    delete[] alpha;
+    delete[] runs;
+    delete[] rowRuns;
+}
+
+uint16_t Surface::getWidth() const {
+    return width;
+}
+
+uint16_t Surface::getHeight() const {
+    return height;
+}
+
+uint8_t Surface::getColorDepth() const {
+    return colorDepth;
+}
+
+uint8_t Surface::getBytesPerPixel() const {
+    return bytesPerPixel;
+}
+
+bool Surface::isFlipped() const {
+    return flipX;
+}
+
+const uint8_t* Surface::getRow(uint16_t row) const {
+    return pixels + row * width * bytesPerPixel;
+}
+
+const uint8_t* Surface::getAlphaRow(uint16_t row) const {
+    return alpha + row * width;
+}
+
+const Surface::Run* Surface::getRuns(uint16_t row) const {
+    return runs + rowRuns[row];
+}
+
+uint32_t Surface::getRunCount(uint16_t row) const {
+    return rowRuns[row + 1] - rowRuns[row];
+}
+
+const Color& Surface::getColor(uint16_t column, uint16_t row) const {
+    const auto imageRow = height - 1 - row;
+    const auto imageColumn = flipX ? width - 1 - column : column;
+    return image.getPixelBuffer()[imageRow * width + imageColumn];
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SURFACE_H
+#define HHUOS_SURFACE_H
+
+#include <cstdint>
+
+namespace Util {
+namespace Graphic {
+class Color;
+class Image;
+}  // namespace Graphic
+}  // namespace Util
+
+namespace Util::Graphic {
+
+/**
+ * An image, converted to the native pixel format of a linear frame buffer, so that it can be copied without any conversion.
+ * Rows are stored top to bottom in screen order (images are stored bottom to top) and may be mirrored horizontally.
+ * Transparency is run-length encoded: Each row consists of runs of either opaque or translucent pixels,
+ * while fully transparent pixels are not part of any run and thus never touched while drawing.
+ */
+class Surface {
+
+public:
+
+    struct Run {
+        uint16_t column;
+        uint16_t length;
+        bool opaque;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param image The image to convert
+     * @param colorDepth The color depth of the target frame buffer
+     * @param flipX Mirror the image horizontally
+     */
+    Surface(const Image &image, uint8_t colorDepth, bool flipX);
+
+    /**
+     * Copy Constructor.
+     */
+    Surface(const Surface &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Surface &operator=(const Surface &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Surface();
+
+    [[nodiscard]] uint16_t getWidth() const;
+
+    [[nodiscard]] uint16_t getHeight() const;
+
+    [[nodiscard]] uint8_t getColorDepth() const;
+
+    [[nodiscard]] uint8_t getBytesPerPixel() const;
+
+    [[nodiscard]] bool isFlipped() const;
+
+    [[nodiscard]] const uint8_t* getRow(uint16_t row) const;
+
+    [[nodiscard]] const uint8_t* getAlphaRow(uint16_t row) const;
+
+    [[nodiscard]] const Run* getRuns(uint16_t row) const;
+
+    [[nodiscard]] uint32_t getRunCount(uint16_t row) const;
+
+    /**
+     * Get the original color of a pixel, which is needed to blend pixels in frame buffers with less than 32 bits per pixel.
+     */
+    [[nodiscard]] const Color& getColor(uint16_t column, uint16_t row) const;
+
+private:
+
+    const Image &image;
+    const uint16_t width;
+    const uint16_t height;
+    const uint8_t colorDepth;
+    const uint8_t bytesPerPixel;
+    const bool flipX;
+
+    uint8_t *pixels;
+    uint8_t *alpha;
+
+    Run *runs;
+    // Index of the first run of each row (with an additional entry for the end of the last row)
+    uint32_t *rowRuns;
+};
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SurfaceDrawer.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/base/CpuDispatch.h"
+#include "lib/util/graphic/Color.h"
+#include "lib/util/graphic/LinearFrameBuffer.h"
+#include "lib/util/graphic/Surface.h"
+
+namespace Util::Graphic {
+
+SurfaceDrawer::SurfaceDrawer(const LinearFrameBuffer &lfb) : lfb(lfb), pixelDrawer(lfb) {}
+
+void SurfaceDrawer::drawSurface(int32_t x, int32_t y, const Surface &surface, uint8_t alpha) const {
+    if (alpha == 0 || surface.getColorDepth() != lfb.getColorDepth()) {
+        return;
+    }
+
+    const auto resolutionX = static_cast<int32_t>(lfb.getResolutionX());
+    const auto resolutionY = static_cast<int32_t>(lfb.getResolutionY());
+    const auto bytesPerPixel = surface.getBytesPerPixel();
+    const auto pitch = lfb.getPitch();
+    auto *buffer = reinterpret_cast<uint8_t*>(lfb.getBuffer().get());
+
+    const auto startRow = y < 0 ? -y : 0;
+    const auto endRow = y + surface.getHeight() > resolutionY ? resolutionY - y : surface.getHeight();
+
+    for (int32_t row = startRow; row < endRow; row++) {
+        const auto screenY = y + row;
+        const auto *runs = surface.getRuns(row);
+        const auto runCount = surface.getRunCount(row);
+
+        for (uint32_t i = 0; i < runCount; i++) {
+            const auto &run = runs[i];
+            auto start = x + run.column;
+            auto end = start + run.length;
+            if (end <= 0 || start >= resolutionX) {
+                continue;
+            }
+
+            const auto column = static_cast<uint16_t>(start < 0 ? run.column - start : run.column);
+            start = start < 0 ? 0 : start;
+            end = end > resolutionX ? resolutionX : end;
+
+            const auto length = static_cast<uint16_t>(end - start);
+            auto *target = buffer + screenY * pitch + start * bytesPerPixel;
+
+            if (run.opaque && alpha == 255) {
+                copy(target, surface.getRow(row) + column * bytesPerPixel, length * bytesPerPixel);
+            } else {
+                blend(target, surface, column, row, length, start, screenY, alpha);
+            }
+        }
+    }
+}
+
+void SurfaceDrawer::copy(uint8_t *target, const uint8_t *source, uint32_t length) {
+    CpuDispatch::getRoutines().copyRange(target, source, length);
+}
+
+void SurfaceDrawer::blend(uint8_t *target, const Surface &surface, uint16_t column, uint16_t row, uint16_t length, uint16_t x, uint16_t y, uint8_t alpha) const {
+    if (surface.getColorDepth() != 32) {
+        // Native pixels with less than 32 bits can not be blended directly, so the original colors are used instead
+        for (uint16_t i = 0; i < length; i++) {
+            const auto &color = surface.getColor(column + i, row);
+            pixelDrawer.drawPixel(x + i, y, color.withAlpha(static_cast<uint8_t>(color.getAlpha() * alpha / 255)));
+        }
+
+        return;
+    }
+
+    auto *targetPixels = reinterpret_cast<uint32_t*>(target);
+    const auto *sourcePixels = reinterpret_cast<const uint32_t*>(surface.getRow(row)) + column;
+    const auto *sourceAlpha = surface.getAlphaRow(row) + column;
+
+    CpuDispatch::getRoutines().blendPixels(targetPixels, sourcePixels, sourceAlpha, length, alpha);
+}
+
+}
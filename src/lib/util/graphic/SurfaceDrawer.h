@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SURFACEDRAWER_H
+#define HHUOS_SURFACEDRAWER_H
+
+#include <cstdint>
+
+#include "lib/util/graphic/PixelDrawer.h"
+
+namespace Util {
+namespace Graphic {
+class LinearFrameBuffer;
+class Surface;
+}  // namespace Graphic
+}  // namespace Util
+
+namespace Util::Graphic {
+
+/**
+ * Draws surfaces onto a linear frame buffer.
+ * Opaque runs are copied and translucent runs are blended with the routines bound by CpuDispatch,
+ * if the frame buffer uses 32 bits per pixel, else translucent runs are blended pixel by pixel.
+ */
+class SurfaceDrawer {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param lfb The linear frame buffer to draw on
+     */
+    explicit SurfaceDrawer(const LinearFrameBuffer &lfb);
+
+    /**
+     * Copy Constructor.
+     */
+    SurfaceDrawer(const SurfaceDrawer &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SurfaceDrawer &operator=(const SurfaceDrawer &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SurfaceDrawer() = default;
+
+    /**
+     * Draw a surface. Parts outside the visible area are clipped.
+     *
+     * @param x The x coordinate of the upper left corner
+     * @param y The y coordinate of the upper left corner
+     * @param surface The surface (must have the same color depth as the frame buffer)
+     * @param alpha Additional opacity, applied to all pixels
+     */
+    void drawSurface(int32_t x, int32_t y, const Surface &surface, uint8_t alpha = 255) const;
+
+private:
+
+    static void copy(uint8_t *target, const uint8_t *source, uint32_t length);
+
+    void blend(uint8_t *target, const Surface &surface, uint16_t column, uint16_t row, uint16_t length, uint16_t x, uint16_t y, uint8_t alpha) const;
+
+    const LinearFrameBuffer &lfb;
+    const PixelDrawer pixelDrawer;
+};
+
+}
+
+#endif
@@ -36,6 +36,19 @@ Terminal::Terminal(uint16_t columns, uint16_t rows) : outputStream(*this), colum
 }
 
 void Terminal::write(uint8_t c) {
+    processCharacter(c);
+    flush();
+}
+
+void Terminal::write(const uint8_t *sourceBuffer, uint32_t offset, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        processCharacter(sourceBuffer[offset + i]);
+    }
+
+    flush();
+}
+
+void Terminal::processCharacter(uint8_t c) {
     if (!ansiParsing) {
         if (c == '\n') {
             clear(foregroundColor, backgroundColor, getCurrentColumn(), getCurrentRow(), columns, getCurrentRow());
@@ -98,12 +111,6 @@ void Terminal::write(uint8_t c) {
     }
 }
 
-void Terminal::write(const uint8_t *sourceBuffer, uint32_t offset, uint32_t length) {
-    for (uint32_t i = 0; i < length; i++) {
-        write(sourceBuffer[offset + i]);
-    }
-}
-
 int16_t Terminal::read() {
     return inputStream.read();
 }
@@ -437,6 +444,7 @@ void Terminal::setKeyboardScancodes(bool enabled) {
 void Terminal::clear() {
     clear(foregroundColor, backgroundColor, 0, 0, getColumns() - 1, getRows() - 1);
     setPosition(0, 0);
+    flush();
 }
 
 const Color& Terminal::getForegroundColor() const {
@@ -466,6 +474,7 @@ void Terminal::TerminalPipedOutputStream::write(uint8_t c) {
                 terminal.setPosition(column, row);
                 terminal.putChar(' ', terminal.foregroundColor, terminal.backgroundColor);
                 terminal.setPosition(column, row);
+                terminal.flush();
             }
 
             auto line = lineBufferStream.getContent().substring(0, lineBufferStream.getLength() - 1);
@@ -166,6 +166,8 @@ private:
         Terminal &terminal;
     };
 
+    void processCharacter(uint8_t c);
+
     static void handleBell();
 
     void handleTab();
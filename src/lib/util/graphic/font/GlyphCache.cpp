@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "GlyphCache.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/graphic/Color.h"
+#include "lib/util/graphic/Font.h"
+#include "lib/util/graphic/LinearFrameBuffer.h"
+#include "lib/util/graphic/PixelDrawer.h"
+#include "lib/util/graphic/StringDrawer.h"
+
+namespace Util::Graphic {
+
+GlyphCache::GlyphCache(uint32_t size) : glyphs(new Glyph[size]), size(size) {
+    for (uint32_t i = 0; i < size; i++) {
+        glyphs[i] = Glyph{nullptr, 0, 0, 0, 0, nullptr, nullptr, 0};
+    }
+}
+
+GlyphCache::~GlyphCache() {
+    for (uint32_t i = 0; i < size; i++) {
+        delete[] glyphs[i].pixels;
+        delete[] glyphs[i].spans;
+    }
+
+    delete[] glyphs;
+}
+
+void GlyphCache::drawChar(const LinearFrameBuffer &lfb, const Font &font, uint16_t x, uint16_t y, char c, const Color &fgColor, const Color &bgColor) const {
+    const auto colorDepth = lfb.getColorDepth();
+    const auto charWidth = font.getCharWidth();
+    const auto charHeight = font.getCharHeight();
+    const auto bgAlpha = bgColor.getAlpha();
+
+    // Only opaque glyphs (optionally with a transparent background), that are completely visible, can be copied
+    bool copyable = (colorDepth == 15 || colorDepth == 16 || colorDepth == 24 || colorDepth == 32) &&
+            fgColor.getAlpha() == 255 && (bgAlpha == 0 || bgAlpha == 255) &&
+            static_cast<uint32_t>(x) + charWidth <= lfb.getResolutionX() &&
+            static_cast<uint32_t>(y) + charHeight <= lfb.getResolutionY();
+
+    if (!copyable) {
+        const PixelDrawer pixelDrawer(lfb);
+        StringDrawer(pixelDrawer).drawChar(font, x, y, c, fgColor, bgColor);
+        return;
+    }
+
+    const auto &glyph = getGlyph(font, static_cast<uint8_t>(c), fgColor, bgColor, colorDepth);
+    const auto bytesPerPixel = static_cast<uint8_t>((colorDepth + 7) / 8);
+    const auto rowSize = static_cast<uint32_t>(charWidth) * bytesPerPixel;
+    const auto pitch = lfb.getPitch();
+    auto *target = reinterpret_cast<uint8_t*>(lfb.getBuffer().get()) + y * pitch + x * bytesPerPixel;
+
+    if (glyph.spans == nullptr) {
+        for (uint32_t row = 0; row < charHeight; row++) {
+            Address<uint32_t>(target + row * pitch).copyRange(Address<uint32_t>(glyph.pixels + row * rowSize), rowSize);
+        }
+    } else {
+        for (uint32_t i = 0; i < glyph.spanCount; i++) {
+            const auto &span = glyph.spans[i];
+            const auto offset = span.column * bytesPerPixel;
+            Address<uint32_t>(target + span.row * pitch + offset).copyRange(Address<uint32_t>(glyph.pixels + span.row * rowSize + offset), span.length * bytesPerPixel);
+        }
+    }
+}
+
+void GlyphCache::drawString(const LinearFrameBuffer &lfb, const Font &font, uint16_t x, uint16_t y, const char *string, const Color &fgColor, const Color &bgColor) const {
+    for (uint32_t i = 0; string[i] >= 0x20 && string[i] <= 0x7e; ++i) {
+        drawChar(lfb, font, x, y, string[i], fgColor, bgColor);
+        x += font.getCharWidth();
+    }
+}
+
+uint32_t GlyphCache::getHitCount() const {
+    return hits;
+}
+
+uint32_t GlyphCache::getMissCount() const {
+    return misses;
+}
+
+GlyphCache::Glyph& GlyphCache::getGlyph(const Font &font, uint8_t c, const Color &fgColor, const Color &bgColor, uint8_t colorDepth) const {
+    const auto foreground = fgColor.getRGB32();
+    const auto background = bgColor.getRGB32();
+
+    uint32_t hash = reinterpret_cast<uint32_t>(&font);
+    hash = hash * 31 + c;
+    hash = hash * 31 + foreground;
+    hash = hash * 31 + background;
+    hash = hash * 31 + colorDepth;
+
+    auto &glyph = glyphs[hash % size];
+    if (glyph.pixels != nullptr && glyph.font == &font && glyph.character == c && glyph.foreground == foreground &&
+            glyph.background == background && glyph.colorDepth == colorDepth) {
+        hits++;
+        return glyph;
+    }
+
+    // Evict the previous occupant of this slot
+    delete[] glyph.pixels;
+    delete[] glyph.spans;
+
+    glyph = Glyph{&font, foreground, background, colorDepth, c, nullptr, nullptr, 0};
+    render(glyph, font, fgColor, bgColor);
+
+    misses++;
+    return glyph;
+}
+
+void GlyphCache::render(Glyph &glyph, const Font &font, const Color &fgColor, const Color &bgColor) {
+    const auto width = font.getCharWidth();
+    const auto height = font.getCharHeight();
+    const auto widthInBytes = static_cast<uint32_t>(width / 8 + ((width % 8 != 0) ? 1 : 0));
+    const auto bytesPerPixel = static_cast<uint8_t>((glyph.colorDepth + 7) / 8);
+    const auto foreground = fgColor.getColorForDepth(glyph.colorDepth);
+    const auto background = bgColor.getColorForDepth(glyph.colorDepth);
+    const auto transparentBackground = bgColor.getAlpha() == 0;
+    const auto *bitmap = font.getChar(glyph.character);
+
+    glyph.pixels = new uint8_t[width * height * bytesPerPixel];
+
+    // Convert each pixel once and count foreground runs, which are needed for a transparent background
+    uint32_t spanCount = 0;
+    for (uint32_t y = 0; y < height; y++) {
+        bool previousSet = false;
+        for (uint32_t x = 0; x < width; x++) {
+            bool set = (bitmap[y * widthInBytes + x / 8] & (0x80 >> (x % 8))) != 0;
+            writePixel(glyph.pixels + (y * width + x) * bytesPerPixel, set ? foreground : background, bytesPerPixel);
+
+            if (set && !previousSet) {
+                spanCount++;
+            }
+
+            previousSet = set;
+        }
+    }
+
+    if (!transparentBackground) {
+        return;
+    }
+
+    glyph.spans = new Span[spanCount > 0 ? spanCount : 1];
+    glyph.spanCount = static_cast<uint16_t>(spanCount);
+
+    uint32_t index = 0;
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            if ((bitmap[y * widthInBytes + x / 8] & (0x80 >> (x % 8))) == 0) {
+                continue;
+            }
+
+            auto start = x;
+            while (x < width && (bitmap[y * widthInBytes + x / 8] & (0x80 >> (x % 8))) != 0) {
+                x++;
+            }
+
+            glyph.spans[index++] = Span{static_cast<uint8_t>(y), static_cast<uint8_t>(start), static_cast<uint8_t>(x - start)};
+        }
+    }
+}
+
+void GlyphCache::writePixel(uint8_t *target, uint32_t value, uint8_t bytesPerPixel) {
+    switch (bytesPerPixel) {
+        case 2:
+            *reinterpret_cast<uint16_t*>(target) = static_cast<uint16_t>(value);
+            break;
+        case 3:
+            target[0] = value & 0xff;
+            target[1] = (value >> 8) & 0xff;
+            target[2] = (value >> 16) & 0xff;
+            break;
+        default:
+            *reinterpret_cast<uint32_t*>(target) = value;
+            break;
+    }
+}
+
+}
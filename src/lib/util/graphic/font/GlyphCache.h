@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_GLYPHCACHE_H
+#define HHUOS_GLYPHCACHE_H
+
+#include <cstdint>
+
+namespace Util {
+namespace Graphic {
+class Color;
+class Font;
+class LinearFrameBuffer;
+}  // namespace Graphic
+}  // namespace Util
+
+namespace Util::Graphic {
+
+/**
+ * Caches rendered characters in the native pixel format of a linear frame buffer.
+ * Glyphs are identified by font, character, foreground color, background color and color depth.
+ * A cached glyph is drawn by copying whole rows (or, with a transparent background, runs of foreground pixels)
+ * into the frame buffer, instead of converting and drawing each pixel separately.
+ * The cache is direct-mapped and has a fixed number of slots, so its memory usage is bounded.
+ * Glyphs, which can not be copied (semi-transparent colors or not fully visible), are drawn pixel by pixel.
+ */
+class GlyphCache {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param size The number of cache slots
+     */
+    explicit GlyphCache(uint32_t size = DEFAULT_SIZE);
+
+    /**
+     * Copy Constructor.
+     */
+    GlyphCache(const GlyphCache &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    GlyphCache &operator=(const GlyphCache &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~GlyphCache();
+
+    /**
+     * Draw a character at a given position.
+     *
+     * @param lfb The frame buffer to draw on
+     * @param font The font
+     * @param x The x coordinate of upper left corner
+     * @param y The y coordinate of upper left corner
+     * @param c The character
+     * @param fgColor The foreground color
+     * @param bgColor The background color
+     */
+    void drawChar(const LinearFrameBuffer &lfb, const Font &font, uint16_t x, uint16_t y, char c, const Color &fgColor, const Color &bgColor) const;
+
+    /**
+     * Draw a null-terminated string at a given position.
+     *
+     * @param lfb The frame buffer to draw on
+     * @param font The font
+     * @param x The x coordinate of upper left corner
+     * @param y The y coordinate of upper left corner
+     * @param string The string
+     * @param fgColor The foreground color
+     * @param bgColor The background color
+     */
+    void drawString(const LinearFrameBuffer &lfb, const Font &font, uint16_t x, uint16_t y, const char *string, const Color &fgColor, const Color &bgColor) const;
+
+    [[nodiscard]] uint32_t getHitCount() const;
+
+    [[nodiscard]] uint32_t getMissCount() const;
+
+    static const constexpr uint32_t DEFAULT_SIZE = 256;
+
+private:
+
+    struct Span {
+        uint8_t row;
+        uint8_t column;
+        uint8_t length;
+    };
+
+    struct Glyph {
+        const Font *font;
+        uint32_t foreground;
+        uint32_t background;
+        uint8_t colorDepth;
+        uint8_t character;
+
+        uint8_t *pixels;
+        // Runs of foreground pixels; Only used, if the background is transparent
+        Span *spans;
+        uint16_t spanCount;
+    };
+
+    Glyph& getGlyph(const Font &font, uint8_t c, const Color &fgColor, const Color &bgColor, uint8_t colorDepth) const;
+
+    static void render(Glyph &glyph, const Font &font, const Color &fgColor, const Color &bgColor);
+
+    static void writePixel(uint8_t *target, uint32_t value, uint8_t bytesPerPixel);
+
+    Glyph *glyphs;
+    uint32_t size;
+
+    mutable uint32_t hits = 0;
+    mutable uint32_t misses = 0;
+};
+
+}
+
+#endif
@@ -20,6 +20,7 @@
 #include "lib/util/graphic/Ansi.h"
 #include "lib/util/io/file/File.h"
 #include "lib/util/base/Exception.h"
+#include "lib/util/base/StringBuilder.h"
 
 namespace Util::Io {
 
@@ -184,8 +185,12 @@ Util::String File::getCanonicalPath(const Util::String &path) {
         return "";
     }
 
-    Util::String parsedPath = Util::Io::File::SEPARATOR + Util::String::join(Util::Io::File::SEPARATOR, parsedToken.toArray());
-    return parsedPath;
+    StringBuilder parsedPath(absolutePath.length());
+    for (uint32_t i = 0; i < parsedToken.size(); i++) {
+        parsedPath.append(Util::Io::File::SEPARATOR).append(parsedToken.get(i));
+    }
+
+    return parsedPath.build();
 }
 
 void File::ensureFileIsOpened() {
@@ -55,6 +55,13 @@ public:
         IS_READY_TO_READ
     };
 
+    /**
+     * Requests to manipulate a regular file (see controlFile()).
+     */
+    enum FileRequest {
+        TRUNCATE
+    };
+
     /**
      * Constructor.
      */
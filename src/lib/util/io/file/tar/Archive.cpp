@@ -71,16 +71,33 @@ Util::Array<Archive::Header> Archive::getFileHeaders() {
     return fileHeaders;
 }
 
+Util::Array<Archive::Header*> Archive::getFileHeaderAddresses() {
+    Util::Array<Header*> fileHeaders(fileCount);
+    uint32_t arrayIndex = 0;
+
+    for (auto *header : headers) {
+        if (header->typeFlag == LF_OLDNORMAL) {
+            fileHeaders[arrayIndex++] = header;
+        }
+    }
+
+    return fileHeaders;
+}
+
 uint8_t *Archive::getFile(const Util::String &path) {
     for (auto *header : headers) {
         if (path == header->filename) {
-            return reinterpret_cast<uint8_t*>(header) + BLOCKSIZE;
+            return getFileData(*header);
         }
     }
 
     return nullptr;
 }
 
+uint8_t *Archive::getFileData(const Header &header) {
+    return reinterpret_cast<uint8_t*>(const_cast<Header*>(&header)) + BLOCKSIZE;
+}
+
 }
 
 
@@ -58,6 +58,15 @@ public:
      */
     Util::Array<Header> getFileHeaders();
 
+    /**
+     * Returns pointers to all file headers within this archive.
+     * In contrast to getFileHeaders(), the headers are not copied,
+     * so that getFileData() can be used to locate a file's contents without searching the archive.
+     *
+     * @return Pointers to all file headers.
+     */
+    Util::Array<Header*> getFileHeaderAddresses();
+
     /**
      * Returns the specified file within this archive.
      *
@@ -74,6 +83,15 @@ public:
      */
     static uint32_t calculateFileSize(const Header &header);
 
+    /**
+     * Returns the data of the file, described by the given header.
+     * The header must reside inside an archive (e.g. obtained via getFileHeaderAddresses()).
+     *
+     * @param header The file's header
+     * @return The file's data, directly following its header
+     */
+    static uint8_t* getFileData(const Header &header);
+
 private:
 
     uint32_t fileCount = 0;
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Matrix4x4.h"
+
+#include "lib/util/math/Math.h"
+
+namespace Util::Math {
+
+Matrix4x4::Matrix4x4() : Matrix4x4(1, 0, 0, 0,
+                                   0, 1, 0, 0,
+                                   0, 0, 1, 0,
+                                   0, 0, 0, 1) {}
+
+Matrix4x4::Matrix4x4(double d11, double d12, double d13, double d14,
+                     double d21, double d22, double d23, double d24,
+                     double d31, double d32, double d33, double d34,
+                     double d41, double d42, double d43, double d44) : values{
+        {d11, d12, d13, d14},
+        {d21, d22, d23, d24},
+        {d31, d32, d33, d34},
+        {d41, d42, d43, d44}} {}
+
+Matrix4x4 Matrix4x4::translation(const Vector3D &translation) {
+    return {
+            1, 0, 0, translation.getX(),
+            0, 1, 0, translation.getY(),
+            0, 0, 1, translation.getZ(),
+            0, 0, 0, 1
+    };
+}
+
+Matrix4x4 Matrix4x4::scaling(const Vector3D &scale) {
+    return {
+            scale.getX(), 0, 0, 0,
+            0, scale.getY(), 0, 0,
+            0, 0, scale.getZ(), 0,
+            0, 0, 0, 1
+    };
+}
+
+// Based on https://en.wikipedia.org/wiki/Rotation_matrix#In_three_dimensions
+Matrix4x4 Matrix4x4::rotation(const Vector3D &rotation) {
+    // Convert degree to radians
+    const auto radians = rotation * (PI / 180);
+
+    const double sinA = sine(radians.getX());
+    const double cosA = cosine(radians.getX());
+    const double sinB = sine(radians.getY());
+    const double cosB = cosine(radians.getY());
+    const double sinC = sine(radians.getZ());
+    const double cosC = cosine(radians.getZ());
+
+    return {
+            cosB * cosC, sinA * sinB * cosC - cosA * sinC, cosA * sinB * cosC + sinA * sinC, 0,
+            cosB * sinC, sinA * sinB * sinC + cosA * cosC, cosA * sinB * sinC - sinA * cosC, 0,
+            -sinB, sinA * cosB, cosA * cosB, 0,
+            0, 0, 0, 1
+    };
+}
+
+// Based on https://en.wikipedia.org/wiki/3D_projection#Perspective_projection
+Matrix4x4 Matrix4x4::perspective(double focalLength) {
+    return {
+            1, 0, 0, 0,
+            0, 1, 0, 0,
+            0, 0, 1, 0,
+            0, 0, 1 / focalLength, 0
+    };
+}
+
+Matrix4x4 Matrix4x4::operator*(const Matrix4x4 &other) const {
+    Matrix4x4 result;
+    for (uint32_t row = 0; row < 4; row++) {
+        for (uint32_t column = 0; column < 4; column++) {
+            result.values[row][column] = values[row][0] * other.values[0][column] + values[row][1] * other.values[1][column] +
+                                         values[row][2] * other.values[2][column] + values[row][3] * other.values[3][column];
+        }
+    }
+
+    return result;
+}
+
+Vector3D Matrix4x4::operator*(const Vector3D &point) const {
+    const auto x = point.getX();
+    const auto y = point.getY();
+    const auto z = point.getZ();
+
+    return {
+            values[0][0] * x + values[0][1] * y + values[0][2] * z + values[0][3],
+            values[1][0] * x + values[1][1] * y + values[1][2] * z + values[1][3],
+            values[2][0] * x + values[2][1] * y + values[2][2] * z + values[2][3]
+    };
+}
+
+Matrix4x4 Matrix4x4::transpose() const {
+    return {
+            values[0][0], values[1][0], values[2][0], values[3][0],
+            values[0][1], values[1][1], values[2][1], values[3][1],
+            values[0][2], values[1][2], values[2][2], values[3][2],
+            values[0][3], values[1][3], values[2][3], values[3][3]
+    };
+}
+
+void Matrix4x4::transform(const Array<Vector3D> &points, Array<Vector3D> &target) const {
+    for (uint32_t i = 0; i < points.length(); i++) {
+        target[i] = *this * points[i];
+    }
+}
+
+bool Matrix4x4::project(const Vector3D &point, Vector2D &target) const {
+    const auto x = point.getX();
+    const auto y = point.getY();
+    const auto z = point.getZ();
+    const auto w = values[3][0] * x + values[3][1] * y + values[3][2] * z + values[3][3];
+
+    if (w <= 0) {
+        return false;
+    }
+
+    target = Vector2D((values[0][0] * x + values[0][1] * y + values[0][2] * z + values[0][3]) / w,
+                      (values[1][0] * x + values[1][1] * y + values[1][2] * z + values[1][3]) / w);
+    return true;
+}
+
+double Matrix4x4::get(uint32_t row, uint32_t column) const {
+    return values[row][column];
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_MATRIX4X4_H
+#define HHUOS_MATRIX4X4_H
+
+#include <cstdint>
+
+#include "lib/util/collection/Array.h"
+#include "lib/util/math/Vector3D.h"
+#include "lib/util/math/Vector2D.h"
+
+namespace Util::Math {
+
+/**
+ * 4x4 matrix for affine and projective transformations of 3D points in homogeneous coordinates.
+ * Points are treated as column vectors with w = 1, so a combined transformation A * B applies B first.
+ */
+class Matrix4x4 {
+
+public:
+    /**
+     * Default Constructor (identity matrix).
+     */
+    Matrix4x4();
+
+    /**
+     * Constructor.
+     */
+    Matrix4x4(double d11, double d12, double d13, double d14,
+              double d21, double d22, double d23, double d24,
+              double d31, double d32, double d33, double d34,
+              double d41, double d42, double d43, double d44);
+
+    /**
+     * Copy Constructor.
+     */
+    Matrix4x4(const Matrix4x4 &other) = default;
+
+    /**
+     * Assignment operator.
+     */
+    Matrix4x4 &operator=(const Matrix4x4 &other) = default;
+
+    /**
+     * Destructor.
+     */
+    ~Matrix4x4() = default;
+
+    /**
+     * Create a translation matrix.
+     */
+    static Matrix4x4 translation(const Vector3D &translation);
+
+    /**
+     * Create a scaling matrix.
+     */
+    static Matrix4x4 scaling(const Vector3D &scale);
+
+    /**
+     * Create a rotation matrix from angles in degrees, equivalent to Vector3D::rotate().
+     * Sine and cosine are calculated once per matrix instead of once per transformed vector.
+     */
+    static Matrix4x4 rotation(const Vector3D &rotation);
+
+    /**
+     * Create a perspective projection, mapping view space points with z > 0 onto the plane at distance 'focalLength'.
+     * After the perspective division, x and y are in the range [-1, 1] for all points inside the view frustum.
+     */
+    static Matrix4x4 perspective(double focalLength);
+
+    Matrix4x4 operator*(const Matrix4x4 &other) const;
+
+    /**
+     * Transform a point (w = 1), ignoring the resulting w component (i.e. no perspective division).
+     */
+    Vector3D operator*(const Vector3D &point) const;
+
+    [[nodiscard]] Matrix4x4 transpose() const;
+
+    /**
+     * Transform multiple points at once (see operator*(const Vector3D&)).
+     * The target array must be at least as long as the source array.
+     */
+    void transform(const Array<Vector3D> &points, Array<Vector3D> &target) const;
+
+    /**
+     * Transform a point (w = 1) and apply the perspective division.
+     *
+     * @param point The point to project
+     * @param target Receives the projected x and y coordinates
+     * @return false, if the point lies on or behind the projection center (w <= 0) and can not be projected
+     */
+    bool project(const Vector3D &point, Vector2D &target) const;
+
+    [[nodiscard]] double get(uint32_t row, uint32_t column) const;
+
+private:
+
+    double values[4][4];
+};
+
+}
+
+#endif
@@ -126,6 +126,10 @@ Vector3D Vector3D::normalize() const {
     return *this * (1 / length());
 }
 
+Vector3D Vector3D::cross(const Vector3D &other) const {
+    return {y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x};
+}
+
 double Vector3D::length() const {
     return sqrt(x * x + y * y + z * z);
 }
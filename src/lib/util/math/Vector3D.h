@@ -82,6 +82,8 @@ public:
 
     [[nodiscard]] Vector3D normalize() const;
 
+    [[nodiscard]] Vector3D cross(const Vector3D &other) const;
+
     [[nodiscard]] double length() const;
 
     [[nodiscard]] double getX() const;
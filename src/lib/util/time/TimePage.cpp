@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TimePage.h"
+
+namespace Util::Time {
+
+Timestamp TimePage::read() const {
+    uint32_t currentSequence;
+    uint32_t currentMultiplier;
+    uint32_t currentShift;
+    uint64_t currentTscBase;
+    uint64_t currentNanosecondsBase;
+
+    do {
+        currentSequence = sequence;
+        asm volatile ("" : : : "memory");
+
+        currentMultiplier = multiplier;
+        currentShift = shift;
+        currentTscBase = tscBase;
+        currentNanosecondsBase = nanosecondsBase;
+
+        asm volatile ("" : : : "memory");
+    } while ((currentSequence & 0x01) != 0 || currentSequence != sequence);
+
+    if (currentMultiplier == 0) {
+        return Timestamp::ofNanoseconds(currentNanosecondsBase);
+    }
+
+    return Timestamp::ofNanoseconds(currentNanosecondsBase + scaleTsc(readTsc() - currentTscBase, currentMultiplier, currentShift));
+}
+
+void TimePage::setTime(const Timestamp &time) {
+    if (multiplier != 0) {
+        return;
+    }
+
+    beginUpdate();
+    nanosecondsBase = time.toNanoseconds();
+    endUpdate();
+}
+
+void TimePage::setTscClocksource(uint64_t tscBase, uint64_t nanosecondsBase, uint32_t multiplier, uint32_t shift) {
+    beginUpdate();
+    TimePage::tscBase = tscBase;
+    TimePage::nanosecondsBase = nanosecondsBase;
+    TimePage::multiplier = multiplier;
+    TimePage::shift = shift;
+    endUpdate();
+}
+
+bool TimePage::hasTscClocksource() const {
+    return multiplier != 0;
+}
+
+uint64_t TimePage::readTsc() {
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+uint64_t TimePage::scaleTsc(uint64_t cycles, uint32_t multiplier, uint32_t shift) {
+    // Split the 64-bit cycle count, so that each partial product fits into 64 bits
+    auto high = static_cast<uint32_t>(cycles >> 32);
+    auto low = static_cast<uint32_t>(cycles);
+
+    auto highProduct = static_cast<uint64_t>(high) * multiplier;
+    auto lowProduct = static_cast<uint64_t>(low) * multiplier;
+
+    return (highProduct << (32 - shift)) + (lowProduct >> shift);
+}
+
+void TimePage::beginUpdate() {
+    sequence = sequence + 1;
+    asm volatile ("" : : : "memory");
+}
+
+void TimePage::endUpdate() {
+    asm volatile ("" : : : "memory");
+    sequence = sequence + 1;
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TIMEPAGE_H
+#define HHUOS_TIMEPAGE_H
+
+#include <cstdint>
+
+#include "Timestamp.h"
+
+namespace Util::Time {
+
+/**
+ * The time base published by the kernel in a read-only page, which is mapped into every process at Util::TIME_PAGE_ADDRESS.
+ * If the kernel uses the time stamp counter as clocksource, the system time is calculated from the current TSC value,
+ * using the published base and scaling factors. Otherwise, the kernel updates the coarse system time on every timer tick.
+ * The kernel increments the sequence counter before and after each update,
+ * so readers can detect and retry torn reads without taking a lock (sequence lock).
+ */
+class TimePage {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    TimePage() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    TimePage(const TimePage &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TimePage &operator=(const TimePage &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TimePage() = default;
+
+    /**
+     * Read the current system time. Can be called from kernel and user space.
+     */
+    [[nodiscard]] Timestamp read() const;
+
+    /**
+     * Publish the coarse system time. Has no effect, if a TSC clocksource has been published.
+     */
+    void setTime(const Timestamp &time);
+
+    /**
+     * Publish the scaling factors of a TSC clocksource.
+     * From then on, the system time is 'nanosecondsBase + ((tsc - tscBase) * multiplier) >> shift'.
+     */
+    void setTscClocksource(uint64_t tscBase, uint64_t nanosecondsBase, uint32_t multiplier, uint32_t shift);
+
+    [[nodiscard]] bool hasTscClocksource() const;
+
+    [[nodiscard]] static uint64_t readTsc();
+
+    /**
+     * Convert a TSC delta to nanoseconds without needing a 128-bit intermediate result.
+     */
+    [[nodiscard]] static uint64_t scaleTsc(uint64_t cycles, uint32_t multiplier, uint32_t shift);
+
+private:
+
+    void beginUpdate();
+
+    void endUpdate();
+
+    volatile uint32_t sequence = 0;
+    volatile uint32_t multiplier = 0;
+    volatile uint32_t shift = 0;
+    volatile uint32_t reserved = 0;
+    volatile uint64_t tscBase = 0;
+    volatile uint64_t nanosecondsBase = 0;
+};
+
+}
+
+#endif
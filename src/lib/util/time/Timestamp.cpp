@@ -155,15 +155,15 @@ bool Timestamp::operator<=(const Timestamp &other) const {
 }
 
 uint64_t Timestamp::toNanoseconds() const {
-    return seconds * 1000000000 + fraction;
+    return static_cast<uint64_t>(seconds) * 1000000000 + fraction;
 }
 
 uint64_t Timestamp::toMicroseconds() const {
-    return seconds * 1000000 + fraction / 1000;
+    return static_cast<uint64_t>(seconds) * 1000000 + fraction / 1000;
 }
 
 uint64_t Timestamp::toMilliseconds() const {
-    return seconds * 1000 + fraction / 1000000;
+    return static_cast<uint64_t>(seconds) * 1000 + fraction / 1000000;
 }
 
 uint32_t Timestamp::toSeconds() const {
@@ -0,0 +1,131 @@
+# Copyright (C) 2018-2024 Heinrich-Heine-Universitaet Duesseldorf,
+# Institute of Computer Science, Department Operating Systems
+# Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+#
+# This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+# License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+# later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+# warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+# Extract the profiling data, written by an instrumented hhuOS build (see Util::Gcov), from a serial log.
+# Each line of the form 'GCDA <path> <hex data>' contains the .gcda file of one translation unit and one run.
+# Since library objects are linked into the kernel and every application, the same file appears several times.
+# All occurrences are merged (runs and counters are summed up) and the result is written to <path>.
+
+import argparse
+import os
+import struct
+import sys
+
+GCOV_DATA_MAGIC = 0x67636461
+GCOV_TAG_FUNCTION = 0x01000000
+GCOV_TAG_COUNTER_MASK = 0xff000000
+GCOV_TAG_OBJECT_SUMMARY = 0xa1000000
+
+
+def get_unit_size(version):
+    """
+    Since GCC 12, record lengths are given in bytes instead of words (the version is encoded like 'B23*').
+    """
+    major = version >> 24
+    if major >= ord('A'):
+        major = (major - ord('A')) * 10 + ((version >> 16) & 0xff) - ord('0')
+    return 4 if major >= 12 else 1
+
+
+def parse_data(data):
+    """
+    Parse a .gcda file into its header words and a list of (tag, payload words) records.
+    """
+    words = list(struct.unpack('<%dI' % (len(data) // 4), data[:len(data) - len(data) % 4]))
+    if len(words) < 3 or words[0] != GCOV_DATA_MAGIC:
+        raise ValueError('Invalid .gcda magic')
+
+    unit_size = get_unit_size(words[1])
+    header_length = 4 if unit_size == 4 else 3
+    header = words[:header_length]
+
+    records = []
+    position = header_length
+    while position + 2 <= len(words):
+        tag = words[position]
+        length = words[position + 1] // unit_size
+        payload = words[position + 2:position + 2 + length]
+        if len(payload) != length:
+            raise ValueError('Truncated record')
+
+        records.append((tag, payload))
+        position += 2 + length
+
+    return header, records
+
+
+def merge_records(target, source):
+    """
+    Merge the records of another run into target (both must originate from the same binary).
+    """
+    if len(target) != len(source):
+        raise ValueError('Record count mismatch')
+
+    for i, ((tag, payload), (other_tag, other_payload)) in enumerate(zip(target, source)):
+        if tag != other_tag or len(payload) != len(other_payload):
+            raise ValueError('Record mismatch')
+
+        if tag == GCOV_TAG_OBJECT_SUMMARY:
+            target[i] = (tag, [payload[0] + other_payload[0], max(payload[1], other_payload[1])])
+        elif tag & GCOV_TAG_COUNTER_MASK == GCOV_TAG_FUNCTION and tag != GCOV_TAG_FUNCTION:
+            merged = []
+            for j in range(0, len(payload), 2):
+                value = (payload[j] | payload[j + 1] << 32) + (other_payload[j] | other_payload[j + 1] << 32)
+                value &= 0xffffffffffffffff
+                merged += [value & 0xffffffff, value >> 32]
+            target[i] = (tag, merged)
+
+
+def write_data(path, header, records):
+    unit_size = get_unit_size(header[1])
+    words = list(header)
+    for tag, payload in records:
+        words += [tag, len(payload) * unit_size] + payload
+
+    directory = os.path.dirname(path)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+    with open(path, 'wb') as file:
+        file.write(struct.pack('<%dI' % len(words), *words))
+
+
+parser = argparse.ArgumentParser(prog='gcda', description='Write .gcda files from the serial log of a hhuOS PGO run')
+parser.add_argument('log', help='Serial log containing the profiling data')
+
+args = parser.parse_args()
+
+profiles = {}
+skipped = 0
+with open(args.log, 'r', errors='replace') as log:
+    for line in log:
+        fields = line.strip().split(' ')
+        if len(fields) != 3 or fields[0] != 'GCDA':
+            continue
+
+        try:
+            header, records = parse_data(bytes.fromhex(fields[2]))
+            if fields[1] in profiles:
+                merge_records(profiles[fields[1]][1], records)
+            else:
+                profiles[fields[1]] = (header, records)
+        except ValueError:
+            skipped += 1
+
+for path, (header, records) in profiles.items():
+    write_data(path, header, records)
+
+print('Written %d .gcda files (%d invalid records skipped)' % (len(profiles), skipped))
+if len(profiles) == 0:
+    sys.exit(1)